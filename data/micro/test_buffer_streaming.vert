@@ -0,0 +1,31 @@
+#version 420 core
+
+#define POSITION		0
+#define MATERIAL		0
+
+precision highp float;
+precision highp int;
+layout(std140, column_major) uniform;
+
+#ifdef UNIFORM_DATA
+	layout(binding = MATERIAL) uniform data
+	{
+		vec4 Position[1024];
+	} Data;
+#else
+	layout(location = POSITION) in vec4 Position;
+#endif
+
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+void main()
+{
+#ifdef UNIFORM_DATA
+	gl_Position = Data.Position[gl_VertexID];
+#else
+	gl_Position = Position;
+#endif
+}
@@ -0,0 +1,18 @@
+#version 430 core
+
+#define FRAG_COLOR		0
+
+precision highp float;
+precision highp int;
+
+in block
+{
+	flat uint DrawID;
+} In;
+
+layout(location = FRAG_COLOR, index = 0) out vec4 Color;
+
+void main()
+{
+	Color = vec4(unpackUnorm4x8(In.DrawID * 2654435761u).rgb, 1.0);
+}
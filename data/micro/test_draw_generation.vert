@@ -0,0 +1,33 @@
+#version 430 core
+
+#define POSITION		0
+#define DRAW_ID			5
+
+#define TRANSFORM		2
+
+precision highp float;
+precision highp int;
+
+layout(binding = TRANSFORM, std430) readonly buffer transform
+{
+	mat4 MVP[];
+} Transform;
+
+layout(location = POSITION) in vec2 Position;
+layout(location = DRAW_ID) in uint DrawID;
+
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+out block
+{
+	flat uint DrawID;
+} Out;
+
+void main()
+{
+	Out.DrawID = DrawID;
+	gl_Position = Transform.MVP[DrawID] * vec4(Position, 0.0, 1.0);
+}
@@ -0,0 +1,62 @@
+#version 430 core
+
+#if defined(BINDLESS_UBO) || defined(BINDLESS_SSBO) || defined(BINDLESS_MULTI_DRAW)
+#extension GL_ARB_bindless_texture : require
+#endif
+
+#define FRAG_COLOR		0
+
+#define DIFFUSE			0
+#define MATERIAL_UNIFORM	0
+#define MATERIAL_STORAGE	1
+
+#define TEXTURE_COUNT	0
+
+#define UNIT_COUNT		16u
+#define BINDLESS_UBO_MAX	1024
+
+precision highp float;
+precision highp int;
+
+layout(location = TEXTURE_COUNT) uniform uint TextureCount;
+
+#if defined(BIND_PER_DRAW)
+	layout(binding = DIFFUSE) uniform sampler2D Diffuse;
+#elif defined(MULTI_BIND)
+	layout(binding = DIFFUSE) uniform sampler2D Diffuse[UNIT_COUNT];
+#elif defined(TEXTURE_ARRAY)
+	layout(binding = DIFFUSE) uniform sampler2DArray Diffuse;
+#elif defined(BINDLESS_UBO)
+	layout(binding = MATERIAL_UNIFORM, std140) uniform material
+	{
+		uvec2 Diffuse[BINDLESS_UBO_MAX];
+	} Material;
+#elif defined(BINDLESS_SSBO) || defined(BINDLESS_MULTI_DRAW)
+	layout(binding = MATERIAL_STORAGE, std430) readonly buffer material
+	{
+		uvec2 Diffuse[];
+	} Material;
+#endif
+
+in block
+{
+	vec2 Texcoord;
+	flat uint DrawID;
+} In;
+
+layout(location = FRAG_COLOR, index = 0) out vec4 Color;
+
+void main()
+{
+	uint TextureIndex = In.DrawID % TextureCount;
+
+#if defined(BIND_PER_DRAW)
+	Color = texture(Diffuse, In.Texcoord);
+#elif defined(MULTI_BIND)
+	Color = texture(Diffuse[In.DrawID % UNIT_COUNT], In.Texcoord);
+#elif defined(TEXTURE_ARRAY)
+	Color = texture(Diffuse, vec3(In.Texcoord, float(TextureIndex)));
+#else
+	Color = texture(sampler2D(Material.Diffuse[TextureIndex]), In.Texcoord);
+#endif
+}
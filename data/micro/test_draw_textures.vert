@@ -0,0 +1,40 @@
+#version 430 core
+
+#if defined(BINDLESS_MULTI_DRAW)
+#extension GL_ARB_shader_draw_parameters : require
+#endif
+
+#define POSITION		0
+#define TEXCOORD		4
+#define DRAW_ID			5
+
+precision highp float;
+precision highp int;
+
+layout(location = POSITION) in vec2 Position;
+layout(location = TEXCOORD) in vec2 Texcoord;
+#if !defined(BINDLESS_MULTI_DRAW)
+	layout(location = DRAW_ID) in uint DrawID;
+#endif
+
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+out block
+{
+	vec2 Texcoord;
+	flat uint DrawID;
+} Out;
+
+void main()
+{
+	Out.Texcoord = Texcoord;
+#if defined(BINDLESS_MULTI_DRAW)
+	Out.DrawID = uint(gl_DrawIDARB);
+#else
+	Out.DrawID = DrawID;
+#endif
+	gl_Position = vec4(Position, 0.0, 1.0);
+}
@@ -0,0 +1,22 @@
+#version 420 core
+
+#define FRAG_COLOR		0
+
+#define DIFFUSE			0
+
+precision highp float;
+precision highp int;
+
+layout(binding = DIFFUSE) uniform sampler2D Diffuse;
+
+in block
+{
+	vec2 Texcoord;
+} In;
+
+layout(location = FRAG_COLOR, index = 0) out vec4 Color;
+
+void main()
+{
+	Color = texture(Diffuse, In.Texcoord);
+}
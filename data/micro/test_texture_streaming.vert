@@ -0,0 +1,21 @@
+#version 420 core
+
+precision highp float;
+precision highp int;
+
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+out block
+{
+	vec2 Texcoord;
+} Out;
+
+void main()
+{
+	// Single triangle covering the viewport
+	Out.Texcoord = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(Out.Texcoord * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -0,0 +1,26 @@
+#version 330 core
+#extension GL_ARB_shading_language_420pack : require
+
+#define FRAG_COLOR		0
+#define MATERIAL		0
+
+precision highp float;
+precision highp int;
+layout(std140, column_major) uniform;
+
+layout(binding = MATERIAL) uniform material
+{
+	vec4 Diffuse;
+} Material;
+
+in block
+{
+	vec4 Color;
+} In;
+
+layout(location = FRAG_COLOR, index = 0) out vec4 Color;
+
+void main()
+{
+	Color = (In.Color + Material.Diffuse) * 0.5;
+}
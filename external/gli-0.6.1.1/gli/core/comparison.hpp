@@ -28,6 +28,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <glm/gtc/packing.hpp>
+
 #include "image.hpp"
 #include "texture1d.hpp"
 #include "texture1d_array.hpp"
@@ -39,6 +42,30 @@
 
 namespace gli
 {
+	/// Texels that differ between two images, blocks for compressed formats
+	struct difference
+	{
+		difference() :
+			Count(0),
+			First(0)
+		{}
+
+		std::size_t Count;
+		/// Index of the first differing texel, only meaningful when Count isn't null
+		std::size_t First;
+	};
+
+	/// Bitwise texel compare.
+	/// Images with different formats or dimensions report every texel of ImageA as different.
+	difference diff(image const & ImageA, image const & ImageB);
+
+	/// Components of half and float formats within Epsilon compare equal, other formats compare bitwise.
+	difference diff(image const & ImageA, image const & ImageB, float Epsilon);
+
+	/// Compare every layer, face and level with the same tolerance rule as diff, an Epsilon of 0 compares bitwise.
+	template <typename texture>
+	bool equal(texture const & TextureA, texture const & TextureB, float Epsilon);
+
 	bool operator==(image const & ImageA, image const & ImageB);
 	bool operator!=(image const & ImageA, image const & ImageB);
 
@@ -26,127 +26,242 @@
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define GLI_SSE2
+#	include <emmintrin.h>
+#endif
+
 namespace gli{
 namespace detail
 {
-	template <typename texture>
-	inline bool equalDataValues(texture const & TextureA, texture const & TextureB)
+	inline bool equalChunk(glm::byte const * A, glm::byte const * B)
 	{
-		// Compare the pointer
-		if(TextureA.data() == TextureB.data())
-			return true;
+#		if defined(GLI_SSE2)
+			__m128i const ChunkA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(A));
+			__m128i const ChunkB = _mm_loadu_si128(reinterpret_cast<__m128i const *>(B));
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(ChunkA, ChunkB)) == 0xFFFF;
+#		else
+			return std::memcmp(A, B, 16) == 0;
+#		endif
+	}
 
-		// Compare the actual data
-		for(typename texture::size_type Level = 0; Level < TextureA.levels(); ++Level)
-		for(typename texture::size_type i = 0; i < TextureA[Level].template size<glm::byte>(); ++i)
-		{
-			glm::byte A = *(TextureA[Level].template data<glm::byte>() + i);
-			glm::byte B = *(TextureB[Level].template data<glm::byte>() + i);
-			if(A != B)
-				return false;
-		}
+	template <typename genType>
+	inline float toFloat(genType Value);
 
-		return true;
+	template <>
+	inline float toFloat(glm::uint16 Value)
+	{
+		return glm::unpackHalf1x16(Value);
 	}
 
-	inline bool equalData(texture1D const & TextureA, texture1D const & TextureB)
+	template <>
+	inline float toFloat(float Value)
 	{
-		return equalDataValues(TextureA, TextureB);
+		return Value;
 	}
 
-	inline bool equalData(texture1DArray const & TextureA, texture1DArray const & TextureB)
+	template <typename genType>
+	inline bool equalComponents(glm::byte const * A, glm::byte const * B, std::size_t BlockSize, float Epsilon)
 	{
-		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
-			if(!equalDataValues(TextureA[Layer], TextureB[Layer]))
+		for(std::size_t Offset = 0; Offset < BlockSize; Offset += sizeof(genType))
+		{
+			if(std::memcmp(A + Offset, B + Offset, sizeof(genType)) == 0)
+				continue;
+
+			genType ValueA, ValueB;
+			std::memcpy(&ValueA, A + Offset, sizeof(genType));
+			std::memcpy(&ValueB, B + Offset, sizeof(genType));
+
+			// NaNs only compare equal bitwise
+			if(!(glm::abs(toFloat(ValueA) - toFloat(ValueB)) <= Epsilon))
 				return false;
+		}
 		return true;
 	}
 
-	inline bool equalData(texture2D const & TextureA, texture2D const & TextureB)
+	inline bool equalBlock(glm::byte const * A, glm::byte const * B, std::size_t BlockSize, format Format, float Epsilon)
 	{
-		return equalDataValues(TextureA, TextureB);
+		if(std::memcmp(A, B, BlockSize) == 0)
+			return true;
+		if(Epsilon <= 0.f)
+			return false;
+
+		switch(Format)
+		{
+		case FORMAT_R16_SFLOAT: case FORMAT_RG16_SFLOAT: case FORMAT_RGB16_SFLOAT: case FORMAT_RGBA16_SFLOAT:
+			return equalComponents<glm::uint16>(A, B, BlockSize, Epsilon);
+		case FORMAT_R32_SFLOAT: case FORMAT_RG32_SFLOAT: case FORMAT_RGB32_SFLOAT: case FORMAT_RGBA32_SFLOAT:
+			return equalComponents<float>(A, B, BlockSize, Epsilon);
+		default:
+			return false;
+		}
 	}
 
-	inline bool equalData(texture2DArray const & TextureA, texture2DArray const & TextureB)
+	// Identical 16 bytes chunks are skipped, only the blocks overlapping a mismatching chunk are compared one by one
+	inline difference diffData(void const * DataA, void const * DataB, std::size_t Size, std::size_t BlockSize, format Format, float Epsilon, bool FirstOnly)
 	{
-		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
-			if(!equalDataValues(TextureA[Layer], TextureB[Layer]))
-				return false;
-		return true;
+		glm::byte const * A = static_cast<glm::byte const *>(DataA);
+		glm::byte const * B = static_cast<glm::byte const *>(DataB);
+		std::size_t const BlockCount = Size / BlockSize;
+
+		difference Result;
+		std::size_t Block = 0;
+		std::size_t Offset = 0;
+		while(Block < BlockCount)
+		{
+			std::size_t End = BlockCount;
+			if(Offset + 16 <= Size)
+			{
+				if(equalChunk(A + Offset, B + Offset))
+				{
+					Offset += 16;
+					continue;
+				}
+				End = std::min((Offset + 16 + BlockSize - 1) / BlockSize, BlockCount);
+			}
+
+			for(Block = std::max(Block, Offset / BlockSize); Block < End; ++Block)
+			{
+				if(equalBlock(A + Block * BlockSize, B + Block * BlockSize, BlockSize, Format, Epsilon))
+					continue;
+				if(Result.Count++ == 0)
+					Result.First = Block;
+				if(FirstOnly)
+					return Result;
+			}
+
+			Offset = Block * BlockSize;
+		}
+
+		return Result;
 	}
 
-	inline bool equalData(texture3D const & TextureA, texture3D const & TextureB)
+	inline bool equalImage(image const & ImageA, image const & ImageB, format Format, float Epsilon)
 	{
-		return equalDataValues(TextureA, TextureB);
+		if(Epsilon <= 0.f)
+			return std::memcmp(ImageA.data(), ImageB.data(), ImageA.size()) == 0;
+		return diffData(ImageA.data(), ImageB.data(), ImageA.size(), block_size(Format), Format, Epsilon, true).Count == 0;
 	}
 
-	inline bool equalData(textureCube const & TextureA, textureCube const & TextureB)
+	// Views covering a single block of their storage compare at once
+	template <typename texture>
+	inline bool equalContiguous(texture const & TextureA, texture const & TextureB, float Epsilon)
 	{
-		for(std::size_t Face = 0; Face < TextureA.faces(); ++Face)
-			if(!equalDataValues(TextureA[Face], TextureB[Face]))
-				return false;
-		return true;
+		if(TextureA.data() == TextureB.data())
+			return true;
+		if(Epsilon <= 0.f)
+			return std::memcmp(TextureA.data(), TextureB.data(), TextureA.size()) == 0;
+		return diffData(TextureA.data(), TextureB.data(), TextureA.size(), block_size(TextureA.format()), TextureA.format(), Epsilon, true).Count == 0;
 	}
 
-	inline bool equalData(textureCubeArray const & TextureA, textureCubeArray const & TextureB)
+	template <typename texture>
+	inline bool equalDataValues(texture const & TextureA, texture const & TextureB, float Epsilon)
 	{
-		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
-			for(std::size_t Face = 0; Face < TextureA[Layer].faces(); ++Face)
-				if(!equalDataValues(TextureA[Layer][Face], TextureB[Layer][Face]))
-					return false;
+		// Compare the pointer
+		if(TextureA.data() == TextureB.data())
+			return true;
+
+		if(TextureA.contiguous() && TextureB.contiguous())
+			return equalContiguous(TextureA, TextureB, Epsilon);
+
+		for(typename texture::size_type Level = 0; Level < TextureA.levels(); ++Level)
+			if(!equalImage(TextureA[Level], TextureB[Level], TextureA.format(), Epsilon))
+				return false;
+
 		return true;
 	}
 
-	inline bool notEqualData(texture1D const & TextureA, texture1D const & TextureB)
+	inline bool equalData(texture1D const & TextureA, texture1D const & TextureB, float Epsilon)
 	{
-		return !equalDataValues(TextureA, TextureB);
+		return equalDataValues(TextureA, TextureB, Epsilon);
 	}
 
-	inline bool notEqualData(texture1DArray const & TextureA, texture1DArray const & TextureB)
+	inline bool equalData(texture1DArray const & TextureA, texture1DArray const & TextureB, float Epsilon)
 	{
+		if(TextureA.contiguous() && TextureB.contiguous())
+			return equalContiguous(TextureA, TextureB, Epsilon);
+
 		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
-			if(!equalDataValues(TextureA[Layer], TextureB[Layer]))
-				return true;
-		return false;
+			if(!equalDataValues(TextureA[Layer], TextureB[Layer], Epsilon))
+				return false;
+		return true;
 	}
 
-	inline bool notEqualData(texture2D const & TextureA, texture2D const & TextureB)
+	inline bool equalData(texture2D const & TextureA, texture2D const & TextureB, float Epsilon)
 	{
-		return !equalDataValues(TextureA, TextureB);
+		return equalDataValues(TextureA, TextureB, Epsilon);
 	}
 
-	inline bool notEqualData(texture2DArray const & TextureA, texture2DArray const & TextureB)
+	inline bool equalData(texture2DArray const & TextureA, texture2DArray const & TextureB, float Epsilon)
 	{
+		if(TextureA.contiguous() && TextureB.contiguous())
+			return equalContiguous(TextureA, TextureB, Epsilon);
+
 		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
-			if(!equalDataValues(TextureA[Layer], TextureB[Layer]))
-				return true;
-		return false;
+			if(!equalDataValues(TextureA[Layer], TextureB[Layer], Epsilon))
+				return false;
+		return true;
 	}
 
-	inline bool notEqualData(texture3D const & TextureA, texture3D const & TextureB)
+	inline bool equalData(texture3D const & TextureA, texture3D const & TextureB, float Epsilon)
 	{
-		return !equalDataValues(TextureA, TextureB);
+		return equalDataValues(TextureA, TextureB, Epsilon);
 	}
 
-	inline bool notEqualData(textureCube const & TextureA, textureCube const & TextureB)
+	inline bool equalData(textureCube const & TextureA, textureCube const & TextureB, float Epsilon)
 	{
+		if(TextureA.contiguous() && TextureB.contiguous())
+			return equalContiguous(TextureA, TextureB, Epsilon);
+
 		for(std::size_t Face = 0; Face < TextureA.faces(); ++Face)
-			if(!equalDataValues(TextureA[Face], TextureB[Face]))
-				return true;
-		return false;
+			if(!equalDataValues(TextureA[Face], TextureB[Face], Epsilon))
+				return false;
+		return true;
 	}
 
-	inline bool notEqualData(textureCubeArray const & TextureA, textureCubeArray const & TextureB)
+	inline bool equalData(textureCubeArray const & TextureA, textureCubeArray const & TextureB, float Epsilon)
 	{
+		if(TextureA.contiguous() && TextureB.contiguous())
+			return equalContiguous(TextureA, TextureB, Epsilon);
+
 		for(std::size_t Layer = 0; Layer < TextureA.layers(); ++Layer)
 			for(std::size_t Face = 0; Face < TextureA[Layer].faces(); ++Face)
-				if(!equalDataValues(TextureA[Layer][Face], TextureB[Layer][Face]))
-					return true;
-		return false;
+				if(!equalDataValues(TextureA[Layer][Face], TextureB[Layer][Face], Epsilon))
+					return false;
+		return true;
 	}
 
 }//namespace detail
 
+	inline difference diff(image const & ImageA, image const & ImageB, float Epsilon)
+	{
+		if(ImageA.empty() || ImageB.empty())
+		{
+			difference Result;
+			Result.Count = ImageA.empty() == ImageB.empty() ? 0 : 1;
+			return Result;
+		}
+
+		format const Format = storage(ImageA).format();
+		std::size_t const BlockSize = block_size(Format);
+
+		if(Format != storage(ImageB).format() || ImageA.size() != ImageB.size() || !glm::all(glm::equal(ImageA.dimensions(), ImageB.dimensions())))
+		{
+			difference Result;
+			Result.Count = std::max<std::size_t>(ImageA.size() / BlockSize, 1);
+			return Result;
+		}
+
+		return detail::diffData(ImageA.data(), ImageB.data(), ImageA.size(), BlockSize, Format, Epsilon, false);
+	}
+
+	inline difference diff(image const & ImageA, image const & ImageB)
+	{
+		return diff(ImageA, ImageB, 0.f);
+	}
+
 	inline bool operator==(image const & ImageA, image const & ImageB)
 	{
 		if(!glm::all(glm::equal(ImageA.dimensions(), ImageB.dimensions())))
@@ -154,29 +269,16 @@ namespace detail
 		if(ImageA.size() != ImageB.size())
 			return false;
 
-		for(std::size_t i = 0; i < ImageA.size<glm::byte>(); ++i)
-			if(*(ImageA.data<glm::byte>() + i) != *(ImageB.data<glm::byte>() + i))
-				return false;
-
-		return true;
+		return std::memcmp(ImageA.data(), ImageB.data(), ImageA.size()) == 0;
 	}
 
 	inline bool operator!=(image const & ImageA, image const & ImageB)
 	{
-		if(!glm::all(glm::equal(ImageA.dimensions(), ImageB.dimensions())))
-			return true;
-		if(ImageA.size() != ImageB.size())
-			return true;
-
-		for(std::size_t i = 0; i < ImageA.size<glm::byte>(); ++i)
-			if(*(ImageA.data<glm::byte>() + i) != *(ImageB.data<glm::byte>() + i))
-				return true;
-
-		return false;
+		return !(ImageA == ImageB);
 	}
 
 	template <typename texture>
-	inline bool equal(texture const & TextureA, texture const & TextureB)
+	inline bool equal(texture const & TextureA, texture const & TextureB, float Epsilon)
 	{
 		if(TextureA.empty() && TextureB.empty())
 			return true;
@@ -195,30 +297,19 @@ namespace detail
 		if(TextureA.size() != TextureB.size())
 			return false;
 
-		return detail::equalData(TextureA, TextureB);
+		return detail::equalData(TextureA, TextureB, Epsilon);
 	}
 
 	template <typename texture>
-	inline bool notEqual(texture const & TextureA, texture const & TextureB)
+	inline bool equal(texture const & TextureA, texture const & TextureB)
 	{
-		if(TextureA.empty() && TextureB.empty())
-			return false;
-		if(TextureA.empty() != TextureB.empty())
-			return true;
-		if(!glm::all(glm::equal(TextureA.dimensions(), TextureB.dimensions())))
-			return true;
-		if(TextureA.layers() != TextureB.layers())
-			return true;
-		if(TextureA.faces() != TextureB.faces())
-			return true;
-		if(TextureA.levels() != TextureB.levels())
-			return true;
-		if(TextureA.format() != TextureB.format())
-			return true;
-		if(TextureA.size() != TextureB.size())
-			return true;
+		return equal(TextureA, TextureB, 0.f);
+	}
 
-		return detail::notEqualData(TextureA, TextureB);
+	template <typename texture>
+	inline bool notEqual(texture const & TextureA, texture const & TextureB)
+	{
+		return !equal(TextureA, TextureB, 0.f);
 	}
 
 	inline bool operator==(gli::texture1D const & A, gli::texture1D const & B)
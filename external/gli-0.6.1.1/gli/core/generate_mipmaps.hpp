@@ -28,13 +28,43 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glm/gtc/packing.hpp>
+
+#include "texture1d.hpp"
+#include "texture1d_array.hpp"
 #include "texture2d.hpp"
+#include "texture2d_array.hpp"
+#include "texture3d.hpp"
+#include "texture_cube.hpp"
+#include "texture_cube_array.hpp"
 
 namespace gli
 {
-	template <typename texture>
-	texture generate_mipmaps(texture & Texture);
+	enum filter
+	{
+		FILTER_BOX,
+		FILTER_KAISER
+	};
 
+	/// Generate in place the levels following the base level of each layer and face.
+	/// Texels are filtered in linear space, sRGB formats included.
+	/// Rows are split across a shared thread pool.
+	/// Return false and leave the texture untouched for compressed, depth, packed 16 bits and 32 bits integer formats.
+	bool generate_mipmaps(texture1D & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(texture1DArray & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(texture2D & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(texture2DArray & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(texture3D & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(textureCube & Texture, filter Filter = FILTER_BOX);
+	bool generate_mipmaps(textureCubeArray & Texture, filter Filter = FILTER_BOX);
 }//namespace gli
 
 #include "generate_mipmaps.inl"
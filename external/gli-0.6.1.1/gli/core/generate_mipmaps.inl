@@ -26,53 +26,921 @@
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define GLI_SSE2
+#	include <emmintrin.h>
+#endif
+
 namespace gli{
 namespace detail
 {
+	// Persistent workers shared by all the generate_mipmaps calls, the calling thread takes chunks too
+	class thread_pool
+	{
+	public:
+		typedef std::function<void(std::size_t Begin, std::size_t End)> task;
 
-}//namespace detail
+		static thread_pool & instance()
+		{
+			static thread_pool Pool;
+			return Pool;
+		}
+
+		void parallel_for(std::size_t Count, std::size_t Grain, task const & Task)
+		{
+			Grain = std::max<std::size_t>(Grain, 1);
+			if(Count <= Grain || this->Workers.empty())
+			{
+				Task(0, Count);
+				return;
+			}
+
+			std::lock_guard<std::mutex> CallLock(this->CallMutex);
+			{
+				std::lock_guard<std::mutex> Lock(this->Mutex);
+				this->Task = &Task;
+				this->Count = Count;
+				this->Grain = Grain;
+				this->Next = 0;
+				this->Active = this->Workers.size();
+				++this->Generation;
+			}
+			this->Wake.notify_all();
+
+			this->run();
 
-	template <>
-	inline texture2D generate_mipmaps(texture2D & Texture)
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->Done.wait(Lock, [this]{return this->Active == 0;});
+		}
+
+	private:
+		thread_pool() :
+			Task(nullptr),
+			Count(0),
+			Grain(1),
+			Next(0),
+			Active(0),
+			Generation(0),
+			Exit(false)
+		{
+			unsigned int const Concurrency = std::thread::hardware_concurrency();
+			for(unsigned int i = 1; i < Concurrency; ++i)
+				this->Workers.push_back(std::thread(&thread_pool::worker, this));
+		}
+
+		~thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(this->Mutex);
+				this->Exit = true;
+			}
+			this->Wake.notify_all();
+
+			for(std::size_t i = 0; i < this->Workers.size(); ++i)
+				this->Workers[i].join();
+		}
+
+		thread_pool(thread_pool const &);
+		thread_pool & operator=(thread_pool const &);
+
+		void worker()
+		{
+			std::size_t Seen = 0;
+			for(;;)
+			{
+				{
+					std::unique_lock<std::mutex> Lock(this->Mutex);
+					this->Wake.wait(Lock, [&]{return this->Exit || this->Generation != Seen;});
+					if(this->Exit)
+						return;
+					Seen = this->Generation;
+				}
+
+				this->run();
+
+				{
+					std::lock_guard<std::mutex> Lock(this->Mutex);
+					--this->Active;
+				}
+				this->Done.notify_one();
+			}
+		}
+
+		void run()
+		{
+			for(;;)
+			{
+				std::size_t const Begin = this->Next.fetch_add(this->Grain);
+				if(Begin >= this->Count)
+					break;
+				(*this->Task)(Begin, std::min(Begin + this->Grain, this->Count));
+			}
+		}
+
+		std::vector<std::thread> Workers;
+		std::mutex CallMutex;
+		std::mutex Mutex;
+		std::condition_variable Wake;
+		std::condition_variable Done;
+		task const * Task;
+		std::size_t Count;
+		std::size_t Grain;
+		std::atomic<std::size_t> Next;
+		std::size_t Active;
+		std::size_t Generation;
+		bool Exit;
+	};
+
+	enum codec_type
 	{
-		texture2D Result(Texture.format(), Texture.dimensions());
-		texture2D::size_type const Components(gli::component_count(Result.format()));
+		CODEC_INVALID,
+		CODEC_UNORM,
+		CODEC_SNORM,
+		CODEC_UINT,
+		CODEC_SINT,
+		CODEC_SFLOAT,
+		CODEC_RGB10A2_UNORM,
+		CODEC_RGB10A2_UINT,
+		CODEC_RG11B10_UFLOAT,
+		CODEC_RGB9E5_UFLOAT
+	};
 
-		for(texture2D::size_type Level = Texture.baseLevel(); Level < Texture.maxLevel(); ++Level)
+	// Describes how a row of texels converts to and from linear glm::vec4
+	struct codec
+	{
+		codec_type Type;
+		glm::uint32 Components;
+		glm::uint32 ComponentSize;
+		bool SRGB;
+
+		std::size_t texel_size() const
 		{
-			// Src
-			std::size_t BaseWidth = Result[Level].dimensions().x;
-			void * DataSrc = Result[Level + 0].data();
+			return this->Components * this->ComponentSize;
+		}
+	};
 
-			// Dst
-			texture2D::dim_type LevelDimensions = texture2D::dim_type(Result[Level].dimensions()) >> texture2D::dim_type(1);
-			LevelDimensions = glm::max(LevelDimensions, texture2D::dim_type(1));
-			void * DataDst = Result[Level + 1].data();
+	inline codec make_codec(codec_type Type, glm::uint32 Components, glm::uint32 ComponentSize, bool SRGB = false)
+	{
+		codec Codec = {Type, Components, ComponentSize, SRGB};
+		return Codec;
+	}
+
+	inline codec find_codec(format Format)
+	{
+		switch(Format)
+		{
+		case FORMAT_R8_UNORM: case FORMAT_L8_UNORM: case FORMAT_A8_UNORM:
+			return make_codec(CODEC_UNORM, 1, 1);
+		case FORMAT_RG8_UNORM: case FORMAT_LA8_UNORM:
+			return make_codec(CODEC_UNORM, 2, 1);
+		case FORMAT_RGB8_UNORM:
+			return make_codec(CODEC_UNORM, 3, 1);
+		case FORMAT_RGBA8_UNORM: case FORMAT_BGRA8_UNORM: case FORMAT_BGRX8_UNORM:
+			return make_codec(CODEC_UNORM, 4, 1);
+		case FORMAT_R16_UNORM: case FORMAT_L16_UNORM: case FORMAT_A16_UNORM:
+			return make_codec(CODEC_UNORM, 1, 2);
+		case FORMAT_RG16_UNORM: case FORMAT_LA16_UNORM:
+			return make_codec(CODEC_UNORM, 2, 2);
+		case FORMAT_RGB16_UNORM:
+			return make_codec(CODEC_UNORM, 3, 2);
+		case FORMAT_RGBA16_UNORM:
+			return make_codec(CODEC_UNORM, 4, 2);
+		case FORMAT_R8_SRGB:
+			return make_codec(CODEC_UNORM, 1, 1, true);
+		case FORMAT_RG8_SRGB:
+			return make_codec(CODEC_UNORM, 2, 1, true);
+		case FORMAT_RGB8_SRGB:
+			return make_codec(CODEC_UNORM, 3, 1, true);
+		case FORMAT_RGBA8_SRGB: case FORMAT_BGRA8_SRGB: case FORMAT_BGRX8_SRGB:
+			return make_codec(CODEC_UNORM, 4, 1, true);
+		case FORMAT_R8_SNORM:
+			return make_codec(CODEC_SNORM, 1, 1);
+		case FORMAT_RG8_SNORM:
+			return make_codec(CODEC_SNORM, 2, 1);
+		case FORMAT_RGB8_SNORM:
+			return make_codec(CODEC_SNORM, 3, 1);
+		case FORMAT_RGBA8_SNORM:
+			return make_codec(CODEC_SNORM, 4, 1);
+		case FORMAT_R16_SNORM:
+			return make_codec(CODEC_SNORM, 1, 2);
+		case FORMAT_RG16_SNORM:
+			return make_codec(CODEC_SNORM, 2, 2);
+		case FORMAT_RGB16_SNORM:
+			return make_codec(CODEC_SNORM, 3, 2);
+		case FORMAT_RGBA16_SNORM:
+			return make_codec(CODEC_SNORM, 4, 2);
+		case FORMAT_R8_UINT:
+			return make_codec(CODEC_UINT, 1, 1);
+		case FORMAT_RG8_UINT:
+			return make_codec(CODEC_UINT, 2, 1);
+		case FORMAT_RGB8_UINT:
+			return make_codec(CODEC_UINT, 3, 1);
+		case FORMAT_RGBA8_UINT:
+			return make_codec(CODEC_UINT, 4, 1);
+		case FORMAT_R16_UINT:
+			return make_codec(CODEC_UINT, 1, 2);
+		case FORMAT_RG16_UINT:
+			return make_codec(CODEC_UINT, 2, 2);
+		case FORMAT_RGB16_UINT:
+			return make_codec(CODEC_UINT, 3, 2);
+		case FORMAT_RGBA16_UINT:
+			return make_codec(CODEC_UINT, 4, 2);
+		case FORMAT_R8_SINT:
+			return make_codec(CODEC_SINT, 1, 1);
+		case FORMAT_RG8_SINT:
+			return make_codec(CODEC_SINT, 2, 1);
+		case FORMAT_RGB8_SINT:
+			return make_codec(CODEC_SINT, 3, 1);
+		case FORMAT_RGBA8_SINT:
+			return make_codec(CODEC_SINT, 4, 1);
+		case FORMAT_R16_SINT:
+			return make_codec(CODEC_SINT, 1, 2);
+		case FORMAT_RG16_SINT:
+			return make_codec(CODEC_SINT, 2, 2);
+		case FORMAT_RGB16_SINT:
+			return make_codec(CODEC_SINT, 3, 2);
+		case FORMAT_RGBA16_SINT:
+			return make_codec(CODEC_SINT, 4, 2);
+		case FORMAT_R16_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 1, 2);
+		case FORMAT_RG16_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 2, 2);
+		case FORMAT_RGB16_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 3, 2);
+		case FORMAT_RGBA16_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 4, 2);
+		case FORMAT_R32_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 1, 4);
+		case FORMAT_RG32_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 2, 4);
+		case FORMAT_RGB32_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 3, 4);
+		case FORMAT_RGBA32_SFLOAT:
+			return make_codec(CODEC_SFLOAT, 4, 4);
+		case FORMAT_RGB10A2_UNORM:
+			return make_codec(CODEC_RGB10A2_UNORM, 1, 4);
+		case FORMAT_RGB10A2_UINT:
+			return make_codec(CODEC_RGB10A2_UINT, 1, 4);
+		case FORMAT_RG11B10_UFLOAT:
+			return make_codec(CODEC_RG11B10_UFLOAT, 1, 4);
+		case FORMAT_RGB9E5_UFLOAT:
+			return make_codec(CODEC_RGB9E5_UFLOAT, 1, 4);
+		default:
+			return make_codec(CODEC_INVALID, 0, 0);
+		}
+	}
 
-			for(std::size_t j = 0; j < LevelDimensions.y; ++j)
-			for(std::size_t i = 0; i < LevelDimensions.x;  ++i)
-			for(std::size_t c = 0; c < Components; ++c)
+	inline float const * srgb_to_linear_table()
+	{
+		static struct table
+		{
+			table()
 			{
-				std::size_t x = (i << 1);
-				std::size_t y = (j << 1);
+				for(int i = 0; i < 256; ++i)
+				{
+					float const Color = static_cast<float>(i) / 255.f;
+					this->Data[i] = Color <= 0.04045f ? Color / 12.92f : std::pow((Color + 0.055f) / 1.055f, 2.4f);
+				}
+			}
 
-				std::size_t Index00 = ((x + 0) + (y + 0) * BaseWidth) * Components + c;
-				std::size_t Index01 = ((x + 0) + (y + 1) * BaseWidth) * Components + c;
-				std::size_t Index11 = ((x + 1) + (y + 1) * BaseWidth) * Components + c;
-				std::size_t Index10 = ((x + 1) + (y + 0) * BaseWidth) * Components + c;
+			float Data[256];
+		} const Table;
 
-				glm::u32 Data00 = reinterpret_cast<glm::byte *>(DataSrc)[Index00];
-				glm::u32 Data01 = reinterpret_cast<glm::byte *>(DataSrc)[Index01];
-				glm::u32 Data11 = reinterpret_cast<glm::byte *>(DataSrc)[Index11];
-				glm::u32 Data10 = reinterpret_cast<glm::byte *>(DataSrc)[Index10];
+		return Table.Data;
+	}
 
-				std::size_t IndexDst = (x + y * LevelDimensions.x) * Components + c;
+	// Rounds to the nearest sRGB code using the linear value of the midpoints between codes, avoiding a pow per component
+	inline glm::u8 linear_to_srgb(float Color)
+	{
+		static struct table
+		{
+			table()
+			{
+				for(int i = 0; i < 255; ++i)
+				{
+					float const Color = (static_cast<float>(i) + 0.5f) / 255.f;
+					this->Thresholds[i] = Color <= 0.04045f ? Color / 12.92f : std::pow((Color + 0.055f) / 1.055f, 2.4f);
+				}
 
-				*(reinterpret_cast<glm::byte *>(DataDst) + IndexDst) = (Data00 + Data01 + Data11 + Data10) >> 2;
+				// First code of each bucket, a bucket never spans more than one threshold
+				for(int i = 0; i <= 4096; ++i)
+					this->Start[i] = static_cast<glm::u8>(std::upper_bound(this->Thresholds, this->Thresholds + 255, static_cast<float>(i) / 4096.f) - this->Thresholds);
 			}
+
+			float Thresholds[255];
+			glm::u8 Start[4097];
+		} const Table;
+
+		Color = std::min(std::max(Color, 0.f), 1.f);
+		int Code = Table.Start[static_cast<int>(Color * 4096.f)];
+		while(Code < 255 && Color >= Table.Thresholds[Code])
+			++Code;
+		return static_cast<glm::u8>(Code);
+	}
+
+	// Bit manipulation conversion, glm::unpackHalf1x16 is much slower
+	inline float half_to_float(glm::uint16 Half)
+	{
+		glm::uint32 const Sign = static_cast<glm::uint32>(Half & 0x8000) << 16;
+		glm::uint32 const Exponent = (Half >> 10) & 0x1F;
+		glm::uint32 const Mantissa = Half & 0x3FF;
+
+		if(Exponent == 0)
+		{
+			float const Denormal = std::ldexp(static_cast<float>(Mantissa), -24);
+			return Sign ? -Denormal : Denormal;
 		}
 
+		glm::uint32 const Bits = Sign | (Exponent == 0x1F ? 0x7F800000 : (Exponent + 112) << 23) | (Mantissa << 13);
+		float Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
 		return Result;
 	}
 
+	// Round to nearest even, denormals and infinities included
+	inline glm::uint16 float_to_half(float Float)
+	{
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &Float, sizeof(Bits));
+		glm::uint32 const Sign = Bits & 0x80000000u;
+		Bits ^= Sign;
+
+		glm::uint32 Half;
+		if(Bits >= (127u + 16u) << 23)
+			Half = Bits > 255u << 23 ? 0x7E00 : 0x7C00;
+		else if(Bits < 113u << 23)
+		{
+			// Let the FPU align the mantissa of denormals
+			glm::uint32 const MagicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+			float Magic;
+			std::memcpy(&Magic, &MagicBits, sizeof(Magic));
+			float Value;
+			std::memcpy(&Value, &Bits, sizeof(Value));
+			Value += Magic;
+			std::memcpy(&Half, &Value, sizeof(Half));
+			Half -= MagicBits;
+		}
+		else
+		{
+			glm::uint32 const Odd = (Bits >> 13) & 1;
+			Bits += ((15u - 127u) << 23) + 0xFFF + Odd;
+			Half = Bits >> 13;
+		}
+
+		return static_cast<glm::uint16>(Half | (Sign >> 16));
+	}
+
+	inline glm::uvec4 unpack_rgb10a2(glm::uint32 Packed)
+	{
+		return glm::uvec4((Packed >> 0) & 0x3FF, (Packed >> 10) & 0x3FF, (Packed >> 20) & 0x3FF, Packed >> 30);
+	}
+
+	// Expects the components already clamped to their range
+	inline glm::uint32 pack_rgb10a2(glm::vec4 const & Color)
+	{
+		glm::uvec4 const Value(glm::round(Color));
+		return (Value.r << 0) | (Value.g << 10) | (Value.b << 20) | (Value.a << 30);
+	}
+
+	inline glm::vec3 unpack_rgb9e5(glm::uint32 Packed)
+	{
+		float const Scale = std::ldexp(1.f, static_cast<int>(Packed >> 27) - 15 - 9);
+		return glm::vec3(
+			static_cast<float>((Packed >> 0) & 0x1FF),
+			static_cast<float>((Packed >> 9) & 0x1FF),
+			static_cast<float>((Packed >> 18) & 0x1FF)) * Scale;
+	}
+
+	inline glm::uint32 pack_rgb9e5(glm::vec3 const & Color)
+	{
+		float const SharedExpMax = 65408.f; // (2^9 - 1) / 2^9 * 2^(31 - 15)
+		glm::vec3 const Clamped = glm::clamp(Color, glm::vec3(0), glm::vec3(SharedExpMax));
+		float const MaxColor = glm::max(glm::max(Clamped.r, Clamped.g), Clamped.b);
+
+		int Exponent = (MaxColor > 0.f ? std::max(-16, static_cast<int>(std::floor(std::log2(MaxColor)))) : -16) + 1 + 15;
+		float Denominator = std::ldexp(1.f, Exponent - 15 - 9);
+		if(static_cast<int>(std::floor(MaxColor / Denominator + 0.5f)) == 512)
+		{
+			Denominator *= 2.f;
+			++Exponent;
+		}
+
+		glm::uvec3 const Mantissa(glm::floor(Clamped / Denominator + 0.5f));
+		return (Mantissa.r << 0) | (Mantissa.g << 9) | (Mantissa.b << 18) | (static_cast<glm::uint32>(Exponent) << 27);
+	}
+
+	template <typename T>
+	inline void decode_components(void const * Src, glm::vec4 * Dst, std::size_t Width, glm::uint32 Components, float Scale, float Min, float const * SRGB)
+	{
+		T const * Texels = static_cast<T const *>(Src);
+		glm::uint32 const Linear = SRGB ? std::min<glm::uint32>(Components, 3) : 0;
+		for(std::size_t x = 0; x < Width; ++x, Texels += Components)
+		{
+			float * Texel = &Dst[x].x;
+			Texel[0] = Texel[1] = Texel[2] = 0.f;
+			Texel[3] = 1.f;
+			for(glm::uint32 c = 0; c < Linear; ++c)
+				Texel[c] = SRGB[static_cast<std::size_t>(Texels[c])];
+			for(glm::uint32 c = Linear; c < Components; ++c)
+				Texel[c] = std::max(static_cast<float>(Texels[c]) * Scale, Min);
+		}
+	}
+
+	template <typename T>
+	inline void encode_components(glm::vec4 const * Src, void * Dst, std::size_t Width, glm::uint32 Components, float Scale, float Min, float Max, bool SRGB)
+	{
+		T * Texels = static_cast<T *>(Dst);
+		glm::uint32 const Linear = SRGB ? std::min<glm::uint32>(Components, 3) : 0;
+		for(std::size_t x = 0; x < Width; ++x, Texels += Components)
+		{
+			float const * Texel = &Src[x].x;
+			for(glm::uint32 c = 0; c < Linear; ++c)
+				Texels[c] = static_cast<T>(linear_to_srgb(Texel[c]));
+			for(glm::uint32 c = Linear; c < Components; ++c)
+			{
+				// Round half away from zero without a libm call
+				float const Value = std::min(std::max(Texel[c] * Scale, Min), Max);
+				Texels[c] = static_cast<T>(static_cast<int>(Value + (Value < 0.f ? -0.5f : 0.5f)));
+			}
+		}
+	}
+
+#	if defined(GLI_SSE2)
+	// Four components rows map one to one on glm::vec4, convert the four lanes at once
+	inline void decode_rgba8_unorm(void const * Src, glm::vec4 * Dst, std::size_t Width)
+	{
+		glm::u8 const * Texels = static_cast<glm::u8 const *>(Src);
+		__m128i const Zero = _mm_setzero_si128();
+		__m128 const Scale = _mm_set1_ps(1.f / 255.f);
+		for(std::size_t x = 0; x < Width; ++x)
+		{
+			int Texel;
+			std::memcpy(&Texel, Texels + x * 4, sizeof(Texel));
+			__m128i const Components = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Texel), Zero), Zero);
+			_mm_storeu_ps(&Dst[x].x, _mm_mul_ps(_mm_cvtepi32_ps(Components), Scale));
+		}
+	}
+
+	inline void encode_rgba8_unorm(glm::vec4 const * Src, void * Dst, std::size_t Width)
+	{
+		glm::u8 * Texels = static_cast<glm::u8 *>(Dst);
+		__m128 const Zero = _mm_setzero_ps();
+		__m128 const Scale = _mm_set1_ps(255.f);
+		__m128 const Half = _mm_set1_ps(0.5f);
+		for(std::size_t x = 0; x < Width; ++x)
+		{
+			__m128 const Value = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&Src[x].x), Scale), Zero), Scale);
+			__m128i Components = _mm_cvttps_epi32(_mm_add_ps(Value, Half));
+			Components = _mm_packs_epi32(Components, Components);
+			Components = _mm_packus_epi16(Components, Components);
+			int const Texel = _mm_cvtsi128_si32(Components);
+			std::memcpy(Texels + x * 4, &Texel, sizeof(Texel));
+		}
+	}
+
+	// Denormals are rescaled by the multiply, infinities and NaNs get their exponent forced
+	inline void decode_rgba16_sfloat(void const * Src, glm::vec4 * Dst, std::size_t Width)
+	{
+		glm::u8 const * Texels = static_cast<glm::u8 const *>(Src);
+		__m128i const Zero = _mm_setzero_si128();
+		__m128i const MaskNoSign = _mm_set1_epi32(0x7FFF);
+		__m128 const Magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+		__m128i const WasInfNaN = _mm_set1_epi32(0x7BFF);
+		__m128i const ExpInfNaN = _mm_set1_epi32(255 << 23);
+		for(std::size_t x = 0; x < Width; ++x)
+		{
+			__m128i const Half = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(Texels + x * 8)), Zero);
+			__m128i const ExpMant = _mm_and_si128(MaskNoSign, Half);
+			__m128i const Sign = _mm_slli_epi32(_mm_xor_si128(Half, ExpMant), 16);
+			__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMant, 13)), Magic);
+			__m128i const InfNaN = _mm_and_si128(_mm_cmpgt_epi32(ExpMant, WasInfNaN), ExpInfNaN);
+			_mm_storeu_ps(&Dst[x].x, _mm_or_ps(Scaled, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaN))));
+		}
+	}
+#	endif//GLI_SSE2
+
+	inline void decode_row(codec const & Codec, void const * Src, glm::vec4 * Dst, std::size_t Width)
+	{
+		bool const Byte = Codec.ComponentSize == 1;
+		glm::uint32 const * Packed = static_cast<glm::uint32 const *>(Src);
+
+#		if defined(GLI_SSE2)
+			if(Codec.Components == 4 && !Codec.SRGB)
+			{
+				if(Codec.Type == CODEC_UNORM && Byte)
+				{
+					decode_rgba8_unorm(Src, Dst, Width);
+					return;
+				}
+				if(Codec.Type == CODEC_SFLOAT && Codec.ComponentSize == 2)
+				{
+					decode_rgba16_sfloat(Src, Dst, Width);
+					return;
+				}
+			}
+#		endif//GLI_SSE2
+
+		switch(Codec.Type)
+		{
+		case CODEC_UNORM:
+			if(Byte)
+				decode_components<glm::u8>(Src, Dst, Width, Codec.Components, 1.f / 255.f, 0.f, Codec.SRGB ? srgb_to_linear_table() : nullptr);
+			else
+				decode_components<glm::u16>(Src, Dst, Width, Codec.Components, 1.f / 65535.f, 0.f, nullptr);
+			break;
+		case CODEC_SNORM:
+			if(Byte)
+				decode_components<glm::i8>(Src, Dst, Width, Codec.Components, 1.f / 127.f, -1.f, nullptr);
+			else
+				decode_components<glm::i16>(Src, Dst, Width, Codec.Components, 1.f / 32767.f, -1.f, nullptr);
+			break;
+		case CODEC_UINT:
+			if(Byte)
+				decode_components<glm::u8>(Src, Dst, Width, Codec.Components, 1.f, 0.f, nullptr);
+			else
+				decode_components<glm::u16>(Src, Dst, Width, Codec.Components, 1.f, 0.f, nullptr);
+			break;
+		case CODEC_SINT:
+			if(Byte)
+				decode_components<glm::i8>(Src, Dst, Width, Codec.Components, 1.f, -128.f, nullptr);
+			else
+				decode_components<glm::i16>(Src, Dst, Width, Codec.Components, 1.f, -32768.f, nullptr);
+			break;
+		case CODEC_SFLOAT:
+			if(Codec.ComponentSize == 4)
+				decode_components<float>(Src, Dst, Width, Codec.Components, 1.f, -std::numeric_limits<float>::max(), nullptr);
+			else
+			{
+				glm::uint16 const * Texels = static_cast<glm::uint16 const *>(Src);
+				for(std::size_t x = 0; x < Width; ++x)
+				{
+					glm::vec4 Texel(0, 0, 0, 1);
+					for(glm::uint32 c = 0; c < Codec.Components; ++c)
+						Texel[c] = half_to_float(Texels[x * Codec.Components + c]);
+					Dst[x] = Texel;
+				}
+			}
+			break;
+		case CODEC_RGB10A2_UNORM:
+			for(std::size_t x = 0; x < Width; ++x)
+				Dst[x] = glm::vec4(unpack_rgb10a2(Packed[x])) / glm::vec4(1023, 1023, 1023, 3);
+			break;
+		case CODEC_RGB10A2_UINT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Dst[x] = glm::vec4(unpack_rgb10a2(Packed[x]));
+			break;
+		case CODEC_RG11B10_UFLOAT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Dst[x] = glm::vec4(glm::unpackF2x11_1x10(Packed[x]), 1);
+			break;
+		case CODEC_RGB9E5_UFLOAT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Dst[x] = glm::vec4(unpack_rgb9e5(Packed[x]), 1);
+			break;
+		default:
+			assert(0);
+			break;
+		}
+	}
+
+	inline void encode_row(codec const & Codec, glm::vec4 const * Src, void * Dst, std::size_t Width)
+	{
+		bool const Byte = Codec.ComponentSize == 1;
+		glm::uint32 * Packed = static_cast<glm::uint32 *>(Dst);
+
+#		if defined(GLI_SSE2)
+			if(Codec.Type == CODEC_UNORM && Byte && Codec.Components == 4 && !Codec.SRGB)
+			{
+				encode_rgba8_unorm(Src, Dst, Width);
+				return;
+			}
+#		endif//GLI_SSE2
+
+		switch(Codec.Type)
+		{
+		case CODEC_UNORM:
+			if(Byte)
+				encode_components<glm::u8>(Src, Dst, Width, Codec.Components, 255.f, 0.f, 255.f, Codec.SRGB);
+			else
+				encode_components<glm::u16>(Src, Dst, Width, Codec.Components, 65535.f, 0.f, 65535.f, false);
+			break;
+		case CODEC_SNORM:
+			if(Byte)
+				encode_components<glm::i8>(Src, Dst, Width, Codec.Components, 127.f, -127.f, 127.f, false);
+			else
+				encode_components<glm::i16>(Src, Dst, Width, Codec.Components, 32767.f, -32767.f, 32767.f, false);
+			break;
+		case CODEC_UINT:
+			if(Byte)
+				encode_components<glm::u8>(Src, Dst, Width, Codec.Components, 1.f, 0.f, 255.f, false);
+			else
+				encode_components<glm::u16>(Src, Dst, Width, Codec.Components, 1.f, 0.f, 65535.f, false);
+			break;
+		case CODEC_SINT:
+			if(Byte)
+				encode_components<glm::i8>(Src, Dst, Width, Codec.Components, 1.f, -128.f, 127.f, false);
+			else
+				encode_components<glm::i16>(Src, Dst, Width, Codec.Components, 1.f, -32768.f, 32767.f, false);
+			break;
+		case CODEC_SFLOAT:
+			if(Codec.ComponentSize == 4)
+			{
+				float * Texels = static_cast<float *>(Dst);
+				for(std::size_t x = 0; x < Width; ++x)
+				for(glm::uint32 c = 0; c < Codec.Components; ++c)
+					Texels[x * Codec.Components + c] = Src[x][c];
+			}
+			else
+			{
+				glm::uint16 * Texels = static_cast<glm::uint16 *>(Dst);
+				for(std::size_t x = 0; x < Width; ++x)
+				for(glm::uint32 c = 0; c < Codec.Components; ++c)
+					Texels[x * Codec.Components + c] = float_to_half(Src[x][c]);
+			}
+			break;
+		case CODEC_RGB10A2_UNORM:
+			for(std::size_t x = 0; x < Width; ++x)
+				Packed[x] = pack_rgb10a2(glm::clamp(Src[x], 0.f, 1.f) * glm::vec4(1023, 1023, 1023, 3));
+			break;
+		case CODEC_RGB10A2_UINT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Packed[x] = pack_rgb10a2(glm::clamp(Src[x], glm::vec4(0), glm::vec4(1023, 1023, 1023, 3)));
+			break;
+		case CODEC_RG11B10_UFLOAT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Packed[x] = glm::packF2x11_1x10(glm::max(glm::vec3(Src[x]), glm::vec3(0)));
+			break;
+		case CODEC_RGB9E5_UFLOAT:
+			for(std::size_t x = 0; x < Width; ++x)
+				Packed[x] = pack_rgb9e5(glm::vec3(Src[x]));
+			break;
+		default:
+			assert(0);
+			break;
+		}
+	}
+
+	// Dst[i] += Src[i] * Weight
+	inline void accumulate(glm::vec4 * Dst, glm::vec4 const * Src, float Weight, std::size_t Count)
+	{
+#		if defined(GLI_SSE2)
+			__m128 const Factor = _mm_set1_ps(Weight);
+			for(std::size_t i = 0; i < Count; ++i)
+				_mm_storeu_ps(&Dst[i].x, _mm_add_ps(_mm_loadu_ps(&Dst[i].x), _mm_mul_ps(_mm_loadu_ps(&Src[i].x), Factor)));
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+				Dst[i] += Src[i] * Weight;
+#		endif
+	}
+
+	// Dst[x] = Sum(Src[clamp(x * 2 + Offset + k)] * Weights[k])
+	inline void reduce_row(glm::vec4 const * Src, std::size_t SrcWidth, glm::vec4 * Dst, std::size_t DstWidth, float const * Weights, std::size_t Taps, int Offset)
+	{
+		int const Last = static_cast<int>(SrcWidth) - 1;
+		for(std::size_t x = 0; x < DstWidth; ++x)
+		{
+			int const First = static_cast<int>(x * 2) + Offset;
+#			if defined(GLI_SSE2)
+				__m128 Sum = _mm_setzero_ps();
+				for(std::size_t k = 0; k < Taps; ++k)
+					Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_loadu_ps(&Src[glm::clamp(First + static_cast<int>(k), 0, Last)].x), _mm_set1_ps(Weights[k])));
+				_mm_storeu_ps(&Dst[x].x, Sum);
+#			else
+				glm::vec4 Sum(0);
+				for(std::size_t k = 0; k < Taps; ++k)
+					Sum += Src[glm::clamp(First + static_cast<int>(k), 0, Last)] * Weights[k];
+				Dst[x] = Sum;
+#			endif
+		}
+	}
+
+	inline double bessel_i0(double Value)
+	{
+		double Sum = 1.0;
+		double Term = 1.0;
+		for(int k = 1; k < 32; ++k)
+		{
+			double const Ratio = Value / (2.0 * k);
+			Term *= Ratio * Ratio;
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	// Windowed sinc for a 2:1 reduction, the taps are centered on the two source texels covered by a destination texel
+	inline float const * kaiser_weights()
+	{
+		static struct table
+		{
+			table()
+			{
+				double const Alpha = 4.0;
+				double const Pi = 3.14159265358979323846;
+				double Weights[6];
+				double Sum = 0.0;
+				for(int k = 0; k < 6; ++k)
+				{
+					double const Distance = static_cast<double>(k) - 2.5;
+					double const Phase = Pi * Distance * 0.5;
+					double const Sinc = std::sin(Phase) / Phase;
+					double const Window = Distance / 3.0;
+					Weights[k] = Sinc * bessel_i0(Alpha * std::sqrt(1.0 - Window * Window)) / bessel_i0(Alpha);
+					Sum += Weights[k];
+				}
+				for(int k = 0; k < 6; ++k)
+					Data[k] = static_cast<float>(Weights[k] / Sum);
+			}
+
+			float Data[6];
+		} const Table;
+
+		return Table.Data;
+	}
+
+#	if defined(GLI_SSE2)
+	// 2x2 box of RGBA8 UNORM rows with the same rounding as the generic path
+	inline void reduce_rgba8(glm::u8 const * Row0, glm::u8 const * Row1, glm::u8 * Dst, std::size_t DstWidth)
+	{
+		__m128i const Zero = _mm_setzero_si128();
+		__m128i const Bias = _mm_set1_epi16(2);
+
+		std::size_t x = 0;
+		for(; x + 2 <= DstWidth; x += 2)
+		{
+			__m128i const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Row0 + x * 8));
+			__m128i const B = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Row1 + x * 8));
+			__m128i const Lo = _mm_add_epi16(_mm_unpacklo_epi8(A, Zero), _mm_unpacklo_epi8(B, Zero));
+			__m128i const Hi = _mm_add_epi16(_mm_unpackhi_epi8(A, Zero), _mm_unpackhi_epi8(B, Zero));
+			__m128i const Sum = _mm_add_epi16(_mm_unpacklo_epi64(Lo, Hi), _mm_unpackhi_epi64(Lo, Hi));
+			__m128i const Average = _mm_srli_epi16(_mm_add_epi16(Sum, Bias), 2);
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(Dst + x * 4), _mm_packus_epi16(Average, Average));
+		}
+
+		for(; x < DstWidth; ++x)
+		for(std::size_t c = 0; c < 4; ++c)
+			Dst[x * 4 + c] = static_cast<glm::u8>((Row0[x * 8 + c] + Row0[x * 8 + 4 + c] + Row1[x * 8 + c] + Row1[x * 8 + 4 + c] + 2) >> 2);
+	}
+#	endif//GLI_SSE2
+
+	inline void generate_level(codec const & Codec, filter Filter, image const & Src, image & Dst)
+	{
+		image::dim_type const SrcDimensions(Src.dimensions());
+		image::dim_type const DstDimensions(Dst.dimensions());
+		std::size_t const TexelSize = Codec.texel_size();
+		std::size_t const SrcPitch = SrcDimensions.x * TexelSize;
+		std::size_t const DstPitch = DstDimensions.x * TexelSize;
+		glm::u8 const * const SrcData = static_cast<glm::u8 const *>(Src.data());
+		glm::u8 * const DstData = static_cast<glm::u8 *>(Dst.data());
+
+		// Roughly 16K texels per task
+		std::size_t const Grain = std::max<std::size_t>(16384 / DstDimensions.x, 1);
+		std::size_t const RowCount = DstDimensions.y * DstDimensions.z;
+
+#		if defined(GLI_SSE2)
+			bool const FastPath = Filter == FILTER_BOX && Codec.Type == CODEC_UNORM && !Codec.SRGB && Codec.Components == 4 && Codec.ComponentSize == 1 &&
+				SrcDimensions.x >= 2 && SrcDimensions.y >= 2 && SrcDimensions.z == 1;
+			if(FastPath)
+			{
+				thread_pool::instance().parallel_for(RowCount, Grain, [&](std::size_t Begin, std::size_t End)
+				{
+					for(std::size_t y = Begin; y < End; ++y)
+						reduce_rgba8(SrcData + y * 2 * SrcPitch, SrcData + (y * 2 + 1) * SrcPitch, DstData + y * DstPitch, DstDimensions.x);
+				});
+				return;
+			}
+#		endif//GLI_SSE2
+
+		float const BoxWeights[] = {0.5f, 0.5f};
+		float const * Weights = Filter == FILTER_KAISER ? kaiser_weights() : BoxWeights;
+		std::size_t const Taps = Filter == FILTER_KAISER ? 6 : 2;
+		int const Offset = Filter == FILTER_KAISER ? -2 : 0;
+
+		thread_pool::instance().parallel_for(RowCount, Grain, [&](std::size_t Begin, std::size_t End)
+		{
+			// Consecutive destination rows share source rows with the Kaiser filter, keep them decoded
+			std::size_t const CacheSize = Taps * 2 + 4;
+			std::vector<glm::vec4> Decoded(SrcDimensions.x * CacheSize);
+			std::vector<std::size_t> Cached(CacheSize, ~std::size_t(0));
+			std::vector<glm::vec4> Column(SrcDimensions.x);
+			std::vector<glm::vec4> Result(DstDimensions.x);
+
+			for(std::size_t Row = Begin; Row < End; ++Row)
+			{
+				std::size_t const y = Row % DstDimensions.y;
+				std::size_t const z = Row / DstDimensions.y;
+
+				std::size_t const Slices[] = {std::min(z * 2, SrcDimensions.z - 1), std::min(z * 2 + 1, SrcDimensions.z - 1)};
+				std::size_t const SliceCount = Slices[0] == Slices[1] ? 1 : 2;
+
+				std::fill(Column.begin(), Column.end(), glm::vec4(0));
+				for(std::size_t s = 0; s < SliceCount; ++s)
+				for(std::size_t k = 0; k < Taps; ++k)
+				{
+					std::size_t const SrcY = static_cast<std::size_t>(glm::clamp(static_cast<int>(y * 2) + Offset + static_cast<int>(k), 0, static_cast<int>(SrcDimensions.y) - 1));
+					std::size_t const SrcRow = Slices[s] * SrcDimensions.y + SrcY;
+					std::size_t const Slot = SrcRow % CacheSize;
+					glm::vec4 * Line = &Decoded[Slot * SrcDimensions.x];
+					if(Cached[Slot] != SrcRow)
+					{
+						decode_row(Codec, SrcData + SrcRow * SrcPitch, Line, SrcDimensions.x);
+						Cached[Slot] = SrcRow;
+					}
+					accumulate(&Column[0], Line, Weights[k] / static_cast<float>(SliceCount), SrcDimensions.x);
+				}
+
+				reduce_row(&Column[0], SrcDimensions.x, &Result[0], DstDimensions.x, Weights, Taps, Offset);
+				encode_row(Codec, &Result[0], DstData + Row * DstPitch, DstDimensions.x);
+			}
+		});
+	}
+
+	template <typename levels>
+	inline bool generate_chain(format Format, filter Filter, std::size_t BaseLevel, std::size_t MaxLevel, levels const & Levels)
+	{
+		codec const Codec = find_codec(Format);
+		if(Codec.Type == CODEC_INVALID)
+			return false;
+
+		for(std::size_t Level = BaseLevel; Level < MaxLevel; ++Level)
+		{
+			image Dst = Levels(Level + 1);
+			generate_level(Codec, Filter, Levels(Level), Dst);
+		}
+
+		return true;
+	}
+}//namespace detail
+
+	inline bool generate_mipmaps(texture1D & Texture, filter Filter)
+	{
+		return detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+		{
+			return Texture[Level];
+		});
+	}
+
+	inline bool generate_mipmaps(texture1DArray & Texture, filter Filter)
+	{
+		for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+			if(!detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+			{
+				return Texture[Layer][Level];
+			}))
+				return false;
+		return true;
+	}
+
+	inline bool generate_mipmaps(texture2D & Texture, filter Filter)
+	{
+		return detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+		{
+			return Texture[Level];
+		});
+	}
+
+	inline bool generate_mipmaps(texture2DArray & Texture, filter Filter)
+	{
+		for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+			if(!detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+			{
+				return Texture[Layer][Level];
+			}))
+				return false;
+		return true;
+	}
+
+	inline bool generate_mipmaps(texture3D & Texture, filter Filter)
+	{
+		return detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+		{
+			return Texture[Level];
+		});
+	}
+
+	inline bool generate_mipmaps(textureCube & Texture, filter Filter)
+	{
+		for(std::size_t Face = 0; Face < Texture.faces(); ++Face)
+			if(!detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+			{
+				return Texture[Face][Level];
+			}))
+				return false;
+		return true;
+	}
+
+	inline bool generate_mipmaps(textureCubeArray & Texture, filter Filter)
+	{
+		for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+		for(std::size_t Face = 0; Face < Texture.faces(); ++Face)
+			if(!detail::generate_chain(Texture.format(), Filter, Texture.baseLevel(), Texture.maxLevel(), [&](std::size_t Level)
+			{
+				return Texture[Layer][Face][Level];
+			}))
+				return false;
+		return true;
+	}
 }//namespace gli
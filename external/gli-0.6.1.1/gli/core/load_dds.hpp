@@ -34,6 +34,8 @@
 namespace gli
 {
 	// Load a texture storage from file
+	// On POSIX systems the file is memory mapped copy-on-write and the storage aliases the mapping:
+	// no copy of the payload is made and the file is never modified by writes to the storage.
 	storage load_dds(char const * Filename);
 
 	// Load a texture storage from file
@@ -41,6 +43,10 @@ namespace gli
 
 	// Load a texture storage from memory
 	storage load_dds(char const * Data, std::size_t Size);
+
+	// Load a texture storage from memory, aliasing Data without copy while the storage keeps Owner alive.
+	// A null Owner copies the payload.
+	storage load_dds(char const * Data, std::size_t Size, std::shared_ptr<void> const & Owner);
 }//namespace gli
 
 #include "load_dds.inl"
@@ -29,6 +29,14 @@
 #include <cstdio>
 #include <cassert>
 
+#if defined(__unix__) || defined(__APPLE__)
+#	define GLI_MMAP
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
 namespace gli{
 namespace detail
 {
@@ -137,9 +145,53 @@ namespace detail
 		glm::uint32					arraySize;
 		glm::uint32					reserved;
 	};
+
+#	if defined(GLI_MMAP)
+	// Private mapping of a whole file, released with the last storage aliasing it
+	class file_mapping
+	{
+	public:
+		file_mapping(char const * Filename) :
+			Base(MAP_FAILED),
+			Size(0)
+		{
+			int const File = open(Filename, O_RDONLY);
+			if(File == -1)
+				return;
+
+			struct stat Stat;
+			if(fstat(File, &Stat) == 0 && Stat.st_size > 0)
+			{
+				this->Size = static_cast<std::size_t>(Stat.st_size);
+				this->Base = mmap(nullptr, this->Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, File, 0);
+			}
+
+			// The mapping stays valid once the descriptor is closed
+			close(File);
+		}
+
+		~file_mapping()
+		{
+			if(this->Base != MAP_FAILED)
+				munmap(this->Base, this->Size);
+		}
+
+		bool valid() const{return this->Base != MAP_FAILED;}
+		char * data() const{return static_cast<char *>(this->Base);}
+		std::size_t size() const{return this->Size;}
+
+	private:
+		file_mapping(file_mapping const &);
+		file_mapping & operator=(file_mapping const &);
+
+		void * Base;
+		std::size_t Size;
+	};
+#	endif//GLI_MMAP
 }//namespace detail
 
-inline storage load_dds(char const * Data, std::size_t Size)
+// Owner is null to copy the payload, otherwise the storage aliases Data and keeps Owner alive
+inline storage load_dds(char const * Data, std::size_t Size, std::shared_ptr<void> const & Owner)
 {
 	assert(Data && (Size >= (sizeof(char[4]) + sizeof(detail::ddsHeader))));
 
@@ -233,6 +285,18 @@ inline storage load_dds(char const * Data, std::size_t Size)
 	if(HeaderDesc.cubemapFlags & detail::DDSCAPS2_VOLUME)
 		DepthCount = HeaderDesc.depth;
 
+	if(Owner)
+	{
+		storage Storage(
+			HeaderDesc10.arraySize, FaceCount, MipMapCount, Format,
+			storage::dim_type(HeaderDesc.width, HeaderDesc.height, DepthCount),
+			Owner, reinterpret_cast<storage::data_type *>(const_cast<char *>(Data + Offset)));
+
+		assert(Offset + Storage.size() == Size);
+
+		return Storage;
+	}
+
 	storage Storage(
 		HeaderDesc10.arraySize, FaceCount, MipMapCount, Format,
 		storage::dim_type(HeaderDesc.width, HeaderDesc.height, DepthCount));
@@ -244,8 +308,21 @@ inline storage load_dds(char const * Data, std::size_t Size)
 	return Storage;
 }
 
+inline storage load_dds(char const * Data, std::size_t Size)
+{
+	return load_dds(Data, Size, std::shared_ptr<void>());
+}
+
 inline storage load_dds(char const * Filename)
 {
+#	if defined(GLI_MMAP)
+	{
+		std::shared_ptr<detail::file_mapping> Mapping(new detail::file_mapping(Filename));
+		if(Mapping->valid())
+			return load_dds(Mapping->data(), Mapping->size(), Mapping);
+	}
+#	endif//GLI_MMAP
+
 	FILE* File = std::fopen(Filename, "rb");
 	assert(File);
 
@@ -72,6 +72,16 @@ namespace gli
 			format_type const & Format,
 			dim_type const & Dimensions);
 
+		// Alias external memory instead of allocating it, Owner keeps the memory alive as long as the storage
+		storage(
+			size_type const & Layers,
+			size_type const & Faces,
+			size_type const & Levels,
+			format_type const & Format,
+			dim_type const & Dimensions,
+			std::shared_ptr<void> const & Owner,
+			data_type * Data);
+
 		bool empty() const;
 		size_type size() const; // Express is bytes
 		format_type format() const;
@@ -114,6 +124,9 @@ namespace gli
 			format_type const Format;
 			dim_type const Dimensions;
 			std::vector<data_type> Data;
+			std::shared_ptr<void> Owner;
+			data_type * External;
+			size_type ExternalSize;
 		};
 
 		std::shared_ptr<impl> Impl;
@@ -33,7 +33,9 @@ namespace gli
 		Faces(0),
 		Levels(0),
 		Format(static_cast<gli::format>(FORMAT_INVALID)),
-		Dimensions(0)
+		Dimensions(0),
+		External(nullptr),
+		ExternalSize(0)
 	{}
 
 	inline storage::impl::impl(
@@ -47,7 +49,9 @@ namespace gli
 		Faces(Faces),
 		Levels(Levels),
 		Format(Format),
-		Dimensions(Dimensions)
+		Dimensions(Dimensions),
+		External(nullptr),
+		ExternalSize(0)
 	{}
 
 	inline storage::storage()
@@ -76,10 +80,40 @@ namespace gli
 		Impl->Data.resize(this->layer_size(0, Faces - 1, 0, Levels - 1) * Layers, 0);
 	}
 
+	inline storage::storage
+	(
+		size_type const & Layers,
+		size_type const & Faces,
+		size_type const & Levels,
+		format_type const & Format,
+		dim_type const & Dimensions,
+		std::shared_ptr<void> const & Owner,
+		data_type * Data
+	) :
+		Impl(new impl(
+			Layers,
+			Faces,
+			Levels,
+			Format,
+			Dimensions))
+	{
+		assert(Layers > 0);
+		assert(Faces > 0);
+		assert(Levels > 0);
+		assert(glm::all(glm::greaterThan(Dimensions, dim_type(0))));
+		assert(Data);
+
+		Impl->Owner = Owner;
+		Impl->External = Data;
+		Impl->ExternalSize = this->layer_size(0, Faces - 1, 0, Levels - 1) * Layers;
+	}
+
 	inline bool storage::empty() const
 	{
 		if(this->Impl.get() == 0)
 			return true;
+		if(this->Impl->External)
+			return this->Impl->ExternalSize == 0;
 		return this->Impl->Data.empty();
 	}
 
@@ -114,6 +148,8 @@ namespace gli
 	{
 		assert(!this->empty());
 
+		if(this->Impl->External)
+			return this->Impl->ExternalSize;
 		return this->Impl->Data.size();
 	}
 
@@ -121,6 +157,8 @@ namespace gli
 	{
 		assert(!this->empty());
 
+		if(this->Impl->External)
+			return this->Impl->External;
 		return &this->Impl->Data[0];
 	}
 
@@ -128,6 +166,8 @@ namespace gli
 	{
 		assert(!this->empty());
 
+		if(this->Impl->External)
+			return this->Impl->External;
 		return &this->Impl->Data[0];
 	}
 
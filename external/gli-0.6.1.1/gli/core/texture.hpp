@@ -71,6 +71,9 @@ namespace gli
 		size_type maxLevel() const;
 		size_type levels() const;
 
+		/// True when the view covers a single block of its storage, addressable from data() to data() + size()
+		bool contiguous() const;
+
 		size_type size() const;
 		template <typename genType>
 		size_type size() const;
@@ -259,6 +262,15 @@ namespace gli
 		return this->maxLevel() - this->baseLevel() + 1;
 	}
 
+	inline bool texture::contiguous() const
+	{
+		// Storage is ordered by layer, face then level
+		bool const AllLevels = this->baseLevel() == 0 && this->maxLevel() == this->Storage.levels() - 1;
+		bool const AllFaces = this->baseFace() == 0 && this->maxFace() == this->Storage.faces() - 1;
+
+		return (AllLevels || (this->faces() == 1 && this->layers() == 1)) && (AllFaces || this->layers() == 1);
+	}
+
 	inline void texture::clear()
 	{
 		memset(this->data<glm::byte>(), 0, this->size<glm::byte>());
@@ -1,127 +1,203 @@
 #include "buffer.hpp"
-#include <memory>
+#include <glm/gtc/round.hpp>
 #include <cassert>
 
-namespace
+namespace gl
 {
-	std::size_t const CHUNK_SIZE(65536);
-	std::size_t const SLICE_SIZE(67108864);
-	std::size_t const PAGE_SIZE(16384);
+	buffer::buffer(std::uint32_t Flags, std::size_t Size) :
+		buffer(Flags, Size, nullptr)
+	{}
 
-	GLenum make_usage(std::uint32_t Flags)
+	buffer::buffer(std::uint32_t Flags, std::size_t Size, void const * Data) :
+		Size(Size),
+		Flags(Flags),
+		Name(0),
+		Persistent(nullptr),
+		Mapped(nullptr),
+		MappedOffset(0)
 	{
-		return 0;
+		assert(!(Flags & SPARSE_BIT) || !(Flags & (READ_BIT | WRITE_BIT)));
+
+		glGenBuffers(1, &this->Name);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		glBufferStorage(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(Size), Data, Flags);
+
+		if(Flags & PERSISTENT_BIT)
+		{
+			GLbitfield Access = Flags & (READ_BIT | WRITE_BIT | PERSISTENT_BIT | COHERENT_BIT);
+			if((Flags & WRITE_BIT) && !(Flags & COHERENT_BIT))
+				Access |= GL_MAP_FLUSH_EXPLICIT_BIT;
+			this->Persistent = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, static_cast<GLsizeiptr>(Size), Access);
+		}
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 	}
 
-	class manager
+	buffer::~buffer()
 	{
-	public:
-
-	private:
-
-	};
-
-	static std::unique_ptr<manager> Manager;
-
+		if(this->Persistent || this->Mapped)
+		{
+			glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		}
 
-	bool const hasImmutableStorage = true;
-}//namespace
-
-namespace gl
-{
-	map_ptr::map_ptr(name_t Name, std::size_t Offset, std::size_t Length, std::uint32_t Access) :
-		Name(Name),
-		Offset(Offset),
-		Length(Length),
-		Access(Access)
-	{
-		glMapNamedBufferRangeEXT(Name, Offset, Length, Access);
+		glDeleteBuffers(1, &this->Name);
+		this->Name = 0;
 	}
 
-	map_ptr::~map_ptr()
+	bool buffer::isValid() const
 	{
-		this->unmap();
+		return this->Name != 0 && (!(this->Flags & PERSISTENT_BIT) || this->Persistent != nullptr);
 	}
 
-	void map_ptr::flush(std::size_t Offset, std::size_t Length) const
+	std::size_t buffer::pageSize()
 	{
-		glFlushMappedNamedBufferRangeEXT(this->Name, Offset, Length);
+		static GLint PageSize(0);
+		if(PageSize == 0)
+			glGetIntegerv(GL_SPARSE_BUFFER_PAGE_SIZE_ARB, &PageSize);
+		return static_cast<std::size_t>(PageSize);
 	}
 
-	void map_ptr::unmap() const
+	void buffer::page(std::uintptr_t Offset, std::size_t Size, bool Commit)
 	{
-		glUnmapNamedBufferEXT(this->Name);
-	}
+		assert(this->Flags & SPARSE_BIT);
+		assert(Offset % pageSize() == 0 && (Size % pageSize() == 0 || Offset + Size == this->Size));
 
-	buffer::buffer(std::size_t Size, const void* Data, std::uint32_t Flags)
-	{
-		glGenBuffers(1, &this->Name);
-		glNamedBufferStorageEXT(this->Name, static_cast<GLsizeiptr>(Size), Data, Flags);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		glBufferPageCommitmentARB(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(Offset), static_cast<GLsizeiptr>(Size), Commit ? GL_TRUE : GL_FALSE);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 	}
 
-	buffer::~buffer()
+	void* buffer::map(std::uintptr_t Offset, std::size_t Size, std::uint32_t Flags)
 	{
-		glDeleteBuffers(1, &this->Name);
-		this->Name = 0;	
-	}
+		assert(!(this->Flags & PERSISTENT_BIT) && !this->Mapped);
+		assert(Offset + Size <= this->Size);
 
-	map_ptr const & buffer::map(GLintptr Offset, GLsizeiptr Length, GLbitfield Flags)
-	{
-		return map_ptr(this->Name, Offset, Length, Flags);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		this->Mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(Offset), static_cast<GLsizeiptr>(Size), Flags);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		this->MappedOffset = Offset;
+
+		return this->Mapped;
 	}
-/*
-	buffer::buffer(std::uint32_t Flags, std::size_t Size) :
-		buffer(Flags, Size, nullptr)
-	{}
 
-	buffer::buffer(std::uint32_t Flags, std::size_t Size, void const * Data) :
-		Size(Size),
-		Flags(Flags)
+	void buffer::unmap()
 	{
-		glGenBuffers(1, &this->Handle);
+		assert(this->Mapped);
 
-		if(hasImmutableStorage)
-			glNamedBufferStorageEXT(this->Handle, static_cast<GLsizeiptr>(Size), Data, Flags);
-		else
-			glNamedBufferDataEXT(this->Handle, static_cast<GLsizeiptr>(Size), Data, ::make_usage(Flags));
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		this->Mapped = nullptr;
 	}
 
-	buffer::~buffer()
+	void buffer::flush(std::uintptr_t Offset, std::size_t Size)
 	{
-		glDeleteBuffers(1, &this->Handle);
-		this->Handle = 0;
+		assert(this->Persistent || this->Mapped);
+		assert(Offset + Size <= this->Size);
+
+		std::uintptr_t const Origin = this->Persistent ? 0 : this->MappedOffset;
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(Offset - Origin), static_cast<GLsizeiptr>(Size));
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 	}
 
-	void* buffer::map(std::uintptr_t Offset, std::size_t Size, std::uint32_t Flags)
+	void buffer::barrier()
 	{
-		return 0;
+		glMemoryBarrier(GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
 	}
 
-	void buffer::unmap(void* memory)
+	void buffer::copy(buffer const & Buffer, std::uintptr_t ReadOffset, std::uintptr_t WriteOffset, std::size_t Size)
 	{
+		assert(ReadOffset + Size <= Buffer.Size && WriteOffset + Size <= this->Size);
 
+		glBindBuffer(GL_COPY_READ_BUFFER, Buffer.Name);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->Name);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+			static_cast<GLintptr>(ReadOffset), static_cast<GLintptr>(WriteOffset), static_cast<GLsizeiptr>(Size));
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 	}
 
-	void buffer::flush(std::uintptr_t Offset, std::size_t Size)
+	ring::ring(std::size_t Size, std::size_t Alignment, std::uint32_t Flags) :
+		Buffer(Flags | buffer::WRITE_BIT | buffer::PERSISTENT_BIT, glm::ceilMultiple(Size, Alignment)),
+		Alignment(Alignment),
+		Head(0),
+		FrameBegin(0)
+	{}
+
+	ring::~ring()
 	{
-		assert(Size <= this->Size);
+		for(std::size_t FrameIndex = 0; FrameIndex < this->Frames.size(); ++FrameIndex)
+			glDeleteSync(this->Frames[FrameIndex].Fence);
+	}
 
-		glFlushMappedNamedBufferRangeEXT(this->Handle, static_cast<GLintptr>(Offset), static_cast<GLsizeiptr>(Size));
+	void ring::retire(bool Wait)
+	{
+		while(!this->Frames.empty())
+		{
+			GLsync const Fence = this->Frames.front().Fence;
+			if(Wait)
+			{
+				while(glClientWaitSync(Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED){}
+				Wait = false;
+			}
+			else if(glClientWaitSync(Fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+				break;
+
+			glDeleteSync(Fence);
+			this->Frames.pop_front();
+		}
 	}
 
-	void buffer::barrier()
+	ring::allocation ring::allocate(std::size_t Size)
+	{
+		std::uint64_t const Capacity = this->Buffer.size();
+		std::uint64_t const Aligned = glm::ceilMultiple<std::uint64_t>(Size, this->Alignment);
+		if(Aligned > Capacity || !this->isValid())
+			return allocation();
+
+		// Skip the end of the buffer rather than splitting an allocation
+		std::uint64_t Begin = this->Head;
+		if(Begin % Capacity + Aligned > Capacity)
+			Begin += Capacity - Begin % Capacity;
+
+		for(;;)
+		{
+			std::uint64_t const Tail = this->Frames.empty() ? this->FrameBegin : this->Frames.front().Begin;
+			if(Begin + Aligned - Tail <= Capacity)
+				break;
+			// The current frame alone doesn't fit in the ring
+			if(this->Frames.empty())
+				return allocation();
+			this->retire(true);
+		}
+
+		this->Head = Begin + Aligned;
+
+		std::uintptr_t const Offset = static_cast<std::uintptr_t>(Begin % Capacity);
+		return allocation(static_cast<char*>(this->Buffer.data()) + Offset, Offset, Size);
+	}
+
+	void ring::flush(allocation const & Allocation)
 	{
-		glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+		if(!(this->Buffer.flags() & buffer::COHERENT_BIT) && Allocation.Pointer)
+			this->Buffer.flush(Allocation.Offset, Allocation.Size);
 	}
 
-	void buffer::copy(buffer const & Buffer, std::uintptr_t ReadOffset, std::uintptr_t WriteOffset, std::size_t Size)
+	void ring::fence()
 	{
-		assert(Buffer.Flags & READ_BIT);
+		this->retire(false);
 
-		glNamedCopyBufferSubDataEXT(
-			Buffer.Handle, this->Handle, 
-			static_cast<GLintptr>(ReadOffset), static_cast<GLintptr>(WriteOffset), static_cast<GLsizeiptr>(Size));
+		if(this->Head == this->FrameBegin)
+			return;
+
+		frame Frame;
+		Frame.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		Frame.Begin = this->FrameBegin;
+		this->Frames.push_back(Frame);
+		this->FrameBegin = this->Head;
 	}
-*/
 }//namespace gl
-
@@ -1,10 +1,10 @@
 #ifndef BUFFER_INCLUDED
 #define BUFFER_INCLUDED
 
-#include <vector>
+#include <GL/glew.h>
+#include <deque>
 #include <cstddef>
 #include <cstdint>
-#include "test.hpp"
 
 namespace gl
 {
@@ -20,99 +20,107 @@ namespace gl
 		noncopyable& operator=(noncopyable const &) = delete;
 	};
 
-	class buffer;
-
-	class map_ptr : noncopyable
-	{
-		friend class buffer;
-
-	private:
-		map_ptr(name_t Name, std::size_t Offset, std::size_t Length, std::uint32_t Access);
-		map_ptr(map_ptr const &);
-		map_ptr& operator=(map_ptr const &);
-
-	public:
-		~map_ptr();
-
-		void flush(std::size_t Offset, std::size_t Length) const;
-		void unmap() const;
-
-	private:
-		name_t const Name;
-		std::size_t const Offset;
-		std::size_t const Length;
-		std::uint32_t const Access;
-	};
-
+	// Buffer with immutable storage. A buffer created with PERSISTENT_BIT is mapped once for its whole lifetime,
+	// coherently with COHERENT_BIT, otherwise CPU writes must be flushed before GL reads them.
+	// A buffer created with SPARSE_BIT has no memory until its pages are committed and can't be mapped.
+	// The member functions operate through the GL_COPY_READ_BUFFER and GL_COPY_WRITE_BUFFER bindings.
 	class buffer : noncopyable
 	{
 	public:
-		buffer(std::size_t Size, const void* Data, std::uint32_t Flags);
-		~buffer();
-
-		map_ptr const & map(GLintptr Offset, GLsizeiptr Length, GLbitfield Flags);
-
-	private:
-		name_t Name;
-	};
-
-/*
-	class buffer : public noncopyable
-	{
-		typedef GLuint handle;
-
-		struct mapping
-		{
-			std::size_t SliceIndex;
-			std::uintptr_t Offset;
-			std::size_t Size;
-		};
-
-	public:
-		enum map_flag
-		{
-			MAP_READ_BIT = (1 << 0),
-			MAP_WRITE_BIT = (1 << 1),
-			MAP_COHERENT_BIT = (1 << 2),
-			MAP_PERSISTENT_BIT = (1 << 3),
-			MAP_UNSYNCHRONIZED_BIT = (1 << 4),
-			MAP_EXPLICIT_FLUSH_BIT = (1 << 5),
-			MAP_INVALIDATE_RANGE_BIT = (1 << 6),
-			MAP_INVALIDATE_BUFFER_BIT = (1 << 7)
-		};
-
 		enum flag
 		{
 			READ_BIT = GL_MAP_READ_BIT,
 			WRITE_BIT = GL_MAP_WRITE_BIT,
 			PERSISTENT_BIT = GL_MAP_PERSISTENT_BIT,
 			COHERENT_BIT = GL_MAP_COHERENT_BIT,
-			SPARSE_BIT = (1 << 8)
+			DYNAMIC_BIT = GL_DYNAMIC_STORAGE_BIT,
+			CLIENT_BIT = GL_CLIENT_STORAGE_BIT,
+			SPARSE_BIT = GL_SPARSE_STORAGE_BIT_ARB
 		};
 
-//		enum usage
-//		{
-//			GL_DYNAMIC_STORAGE_BIT, GL_MAP_READ_BIT GL_MAP_WRITE_BIT, GL_MAP_PERSISTENT_BIT, GL_MAP_COHERENT_BIT, and GL_CLIENT_STORAGE_BIT
-//		};
-
 		buffer(std::uint32_t Flags, std::size_t Size);
 		buffer(std::uint32_t Flags, std::size_t Size, void const * Data);
 		~buffer();
 
+		bool isValid() const;
+		name_t name() const{return this->Name;}
+		std::size_t size() const{return this->Size;}
+		std::uint32_t flags() const{return this->Flags;}
+
+		// Pointer to the persistent mapping, null without PERSISTENT_BIT
+		void* data() const{return this->Persistent;}
+
+		// Commit or release the memory of a sparse buffer, Offset and Size are multiples of pageSize()
 		void page(std::uintptr_t Offset, std::size_t Size, bool Commit);
+		static std::size_t pageSize();
+
+		// Transient mapping of a buffer created without PERSISTENT_BIT, Flags are GL_MAP_* bits
 		void* map(std::uintptr_t Offset, std::size_t Size, std::uint32_t Flags);
-		void unmap(void* memory);
+		void unmap();
+		// Make the CPU writes of a non coherent mapping visible to GL, Offset is relative to the buffer
 		void flush(std::uintptr_t Offset, std::size_t Size);
+		// Make the GL writes visible to a persistent mapping once a fence placed after the barrier is signaled
 		void barrier();
 		void copy(buffer const & Buffer, std::uintptr_t ReadOffset, std::uintptr_t WriteOffset, std::size_t Size);
 
 	private:
 		std::size_t const Size;
 		std::uint32_t const Flags;
-		handle Handle;
-		std::vector<mapping> Mappings;
+		name_t Name;
+		void* Persistent;
+		void* Mapped;
+		std::uintptr_t MappedOffset;
+	};
+
+	// Per frame suballocator over a persistently mapped buffer. Allocations are linear in the buffer
+	// and wrap around, fence() closes the frame and a frame's memory is reused once its fence is signaled,
+	// so streaming uniforms or vertices needs neither map calls nor buffer orphaning.
+	class ring : noncopyable
+	{
+	public:
+		struct allocation
+		{
+			allocation() : Pointer(nullptr), Offset(0), Size(0) {}
+			allocation(void* Pointer, std::uintptr_t Offset, std::size_t Size) : Pointer(Pointer), Offset(Offset), Size(Size) {}
+
+			// Null when the request can't fit in the ring
+			void* Pointer;
+			// Offset in the ring buffer, for glBindBufferRange or the draw offsets
+			std::uintptr_t Offset;
+			std::size_t Size;
+		};
+
+		// Without COHERENT_BIT in Flags, each allocation must be flushed after it is written.
+		// Alignment is typically GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT.
+		ring(std::size_t Size, std::size_t Alignment, std::uint32_t Flags = buffer::COHERENT_BIT);
+		~ring();
+
+		bool isValid() const{return this->Buffer.isValid();}
+		name_t name() const{return this->Buffer.name();}
+		std::size_t size() const{return this->Buffer.size();}
+
+		// Waits for the oldest frames when the ring is full
+		allocation allocate(std::size_t Size);
+		void flush(allocation const & Allocation);
+		// Call once per frame after the last command using the frame allocations
+		void fence();
+
+	private:
+		struct frame
+		{
+			GLsync Fence;
+			std::uint64_t Begin;
+		};
+
+		void retire(bool Wait);
+
+		buffer Buffer;
+		std::size_t const Alignment;
+		// Positions increase monotonically, the offset in the buffer is the position modulo the buffer size
+		std::uint64_t Head;
+		std::uint64_t FrameBegin;
+		std::deque<frame> Frames;
 	};
-*/
 }//namespace gl
 
 #endif//BUFFER_INCLUDED
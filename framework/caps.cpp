@@ -22,6 +22,45 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "caps.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+extensionSet::extensionSet(bool Indexed)
+{
+	// Core profiles requested below 3.0 get a context without glGetStringi
+	if(Indexed && glGetStringi)
+	{
+		GLint Count = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &Count);
+
+		this->Names.reserve(static_cast<std::size_t>(Count));
+		for(GLint i = 0; i < Count; ++i)
+			this->Names.insert(reinterpret_cast<char const*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))));
+		return;
+	}
+
+	char const* String = reinterpret_cast<char const*>(glGetString(GL_EXTENSIONS));
+	if(!String)
+		return;
+
+	for(char const* Begin = String; *Begin;)
+	{
+		char const* End = strchr(Begin, ' ');
+		if(!End)
+			End = Begin + strlen(Begin);
+
+		if(End > Begin)
+			this->Names.insert(std::string(Begin, End));
+		Begin = *End ? End + 1 : End;
+	}
+}
+
+bool extensionSet::isSupported(char const * Name) const
+{
+	return this->Names.find(Name) != this->Names.end();
+}
 
 bool caps::check(GLint MajorVersionRequire, GLint MinorVersionRequire)
 {
@@ -94,720 +133,70 @@ void caps::initVersion()
 	}
 }
 
+namespace
+{
+	struct extensionName
+	{
+		char const * Name;
+		caps::extension Extension;
+	};
+
+	bool operator<(extensionName const & A, extensionName const & B)
+	{
+		return strcmp(A.Name, B.Name) < 0;
+	}
+
+	// Names of the extensions known by caps sorted for binary searches, built once for all contexts
+	std::vector<extensionName> const & sortedExtensionNames()
+	{
+		static std::vector<extensionName> const Names = []()
+		{
+			std::vector<extensionName> Result;
+#			define CAPS_EXTENSION(Name) Result.push_back(extensionName{"GL_" #Name, caps::extension::Name});
+#			include "caps_extensions.inl"
+#			undef CAPS_EXTENSION
+			std::sort(Result.begin(), Result.end());
+			return Result;
+		}();
+
+		return Names;
+	}
+}//namespace
+
+void caps::setExtension(extension Extension)
+{
+	switch(Extension)
+	{
+#	define CAPS_EXTENSION(Name) case extension::Name: ExtensionData.Name = true; break;
+#	include "caps_extensions.inl"
+#	undef CAPS_EXTENSION
+	default:
+		assert(0);
+		break;
+	}
+}
+
 void caps::initExtensions()
 {
 	memset(&ExtensionData, 0, sizeof(ExtensionData));
 
-	glGetIntegerv(GL_NUM_EXTENSIONS, &VersionData.NUM_EXTENSIONS);
+	std::vector<extensionName> const & Names = sortedExtensionNames();
+	std::unordered_set<std::string> const & Supported = this->SupportedExtensions.getNames();
 
-	if((this->VersionData.PROFILE == CORE) || (this->VersionData.PROFILE == COMPATIBILITY))
+	for(std::unordered_set<std::string>::const_iterator Extension = Supported.begin(); Extension != Supported.end(); ++Extension)
 	{
-		for (GLint i = 0; i < VersionData.NUM_EXTENSIONS; ++i)
-		{
-			const char* Extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
-			if(!strcmp("GL_ARB_multitexture", Extension)) {
-				ExtensionData.ARB_multitexture = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_transpose_matrix", Extension)) {
-				ExtensionData.ARB_transpose_matrix = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_multisample", Extension)) {
-				ExtensionData.ARB_multisample = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_env_add", Extension)) {
-				ExtensionData.ARB_texture_env_add = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_cube_map", Extension)) {
-				ExtensionData.ARB_texture_cube_map = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_compression", Extension)) {
-				ExtensionData.ARB_texture_compression = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_border_clamp", Extension)) {
-				ExtensionData.ARB_texture_border_clamp = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_point_parameters", Extension)) {
-				ExtensionData.ARB_point_parameters = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_blend", Extension)) {
-				ExtensionData.ARB_vertex_blend = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_matrix_palette", Extension)) {
-				ExtensionData.ARB_matrix_palette = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_env_combine", Extension)) {
-				ExtensionData.ARB_texture_env_combine = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_env_crossbar", Extension)) {
-				ExtensionData.ARB_texture_env_crossbar = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_env_dot3", Extension)) {
-				ExtensionData.ARB_texture_env_dot3 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_mirrored_repeat", Extension)) { 
-				ExtensionData.ARB_texture_mirrored_repeat = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_depth_texture", Extension)) {
-				ExtensionData.ARB_depth_texture = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shadow", Extension)) {
-				ExtensionData.ARB_shadow = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shadow_ambient", Extension)) {
-				ExtensionData.ARB_shadow_ambient = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_window_pos", Extension)) {
-				ExtensionData.ARB_window_pos = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_program", Extension)) {
-				ExtensionData.ARB_vertex_program = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_fragment_program", Extension)) {
-				ExtensionData.ARB_fragment_program = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_buffer_object", Extension)) {
-				ExtensionData.ARB_vertex_buffer_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_occlusion_query", Extension)) {
-				ExtensionData.ARB_occlusion_query = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_objects", Extension)) {
-				ExtensionData.ARB_shader_objects = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_shader", Extension)) {
-				ExtensionData.ARB_vertex_shader = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_fragment_shader", Extension)) {
-				ExtensionData.ARB_fragment_shader = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shading_language_100", Extension)) {
-				ExtensionData.ARB_shading_language_100 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_non_power_of_two", Extension)) {
-				ExtensionData.ARB_texture_non_power_of_two = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_point_sprite", Extension)) {
-				ExtensionData.ARB_point_sprite = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_fragment_program_shadow", Extension)) {
-				ExtensionData.ARB_fragment_program_shadow = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_draw_buffers", Extension)) {
-				ExtensionData.ARB_draw_buffers = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_rectangle", Extension)) {
-				ExtensionData.ARB_texture_rectangle = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_color_buffer_float", Extension)) {
-				ExtensionData.ARB_color_buffer_float = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_half_float_pixel", Extension)) {
-				ExtensionData.ARB_half_float_pixel = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_float", Extension)) {
-				ExtensionData.ARB_texture_float = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_pixel_buffer_object", Extension)) {
-				ExtensionData.ARB_pixel_buffer_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_depth_buffer_float", Extension)) {
-				ExtensionData.ARB_depth_buffer_float = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_draw_instanced", Extension)) {
-				ExtensionData.ARB_draw_instanced = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_framebuffer_object", Extension)) {
-				ExtensionData.ARB_framebuffer_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_framebuffer_sRGB", Extension)) {
-				ExtensionData.ARB_framebuffer_sRGB = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_geometry_shader4", Extension)) {
-				ExtensionData.ARB_geometry_shader4 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_half_float_vertex", Extension)) {
-				ExtensionData.ARB_half_float_vertex = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_instanced_arrays", Extension)) {
-				ExtensionData.ARB_instanced_arrays = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_map_buffer_range", Extension)) {
-				ExtensionData.ARB_map_buffer_range = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_buffer_object", Extension)) {
-				ExtensionData.ARB_texture_buffer_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_compression_rgtc", Extension)) {
-				ExtensionData.ARB_texture_compression_rgtc = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_rg", Extension)) {
-				ExtensionData.ARB_texture_rg = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_array_object", Extension)) {
-				ExtensionData.ARB_vertex_array_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_uniform_buffer_object", Extension)) {
-				ExtensionData.ARB_uniform_buffer_object = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_compatibility", Extension)) {
-				ExtensionData.ARB_compatibility = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_copy_buffer", Extension)) {
-				ExtensionData.ARB_copy_buffer = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_texture_lod", Extension)) {
-				ExtensionData.ARB_shader_texture_lod = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_depth_clamp", Extension)) {
-				ExtensionData.ARB_depth_clamp = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_draw_elements_base_vertex", Extension)) {
-				ExtensionData.ARB_draw_elements_base_vertex = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_fragment_coord_conventions", Extension)) {
-				ExtensionData.ARB_fragment_coord_conventions = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_provoking_vertex", Extension)) {
-				ExtensionData.ARB_provoking_vertex = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_seamless_cube_map", Extension)) {
-				ExtensionData.ARB_seamless_cube_map = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_sync", Extension)) {
-				ExtensionData.ARB_sync = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_multisample", Extension)) {
-				ExtensionData.ARB_texture_multisample = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_array_bgra", Extension)) {
-				ExtensionData.ARB_vertex_array_bgra = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_draw_buffers_blend", Extension)) {
-				ExtensionData.ARB_draw_buffers_blend = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_sample_shading", Extension)) {
-				ExtensionData.ARB_sample_shading = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_cube_map_array", Extension)) {
-				ExtensionData.ARB_texture_cube_map_array = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_gather", Extension)) {
-				ExtensionData.ARB_texture_gather = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_query_lod", Extension)) {
-				ExtensionData.ARB_texture_query_lod = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shading_language_include", Extension)) {
-				ExtensionData.ARB_shading_language_include = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_compression_bptc", Extension)) {
-				ExtensionData.ARB_texture_compression_bptc = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_blend_func_extended", Extension)) {
-				ExtensionData.ARB_blend_func_extended = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_explicit_attrib_location", Extension)) {
-				ExtensionData.ARB_explicit_attrib_location = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_occlusion_query2", Extension)) {
-				ExtensionData.ARB_occlusion_query2 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_sampler_objects", Extension)) {
-				ExtensionData.ARB_sampler_objects = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_bit_encoding", Extension)) {
-				ExtensionData.ARB_shader_bit_encoding = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_rgb10_a2ui", Extension)) {
-				ExtensionData.ARB_texture_rgb10_a2ui = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_swizzle", Extension)) {
-				ExtensionData.ARB_texture_swizzle = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_timer_query", Extension)) {
-				ExtensionData.ARB_timer_query = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_type_2_10_10_10_rev", Extension)) {
-				ExtensionData.ARB_vertex_type_2_10_10_10_rev = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_draw_indirect", Extension)) {
-				ExtensionData.ARB_draw_indirect = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_gpu_shader5", Extension)) {
-				ExtensionData.ARB_gpu_shader5 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_gpu_shader_fp64", Extension)) {
-				ExtensionData.ARB_gpu_shader_fp64 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_subroutine", Extension)) {
-				ExtensionData.ARB_shader_subroutine = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_tessellation_shader", Extension)) {
-				ExtensionData.ARB_tessellation_shader = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_texture_buffer_object_rgb32", Extension)) {
-				ExtensionData.ARB_texture_buffer_object_rgb32 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_transform_feedback2", Extension)) {
-				ExtensionData.ARB_transform_feedback2 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_transform_feedback3", Extension)) {
-				ExtensionData.ARB_transform_feedback3 = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_ES2_compatibility", Extension)) {
-				ExtensionData.ARB_ES2_compatibility = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_get_program_binary", Extension)) {
-				ExtensionData.ARB_get_program_binary = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_separate_shader_objects", Extension)) {
-				ExtensionData.ARB_separate_shader_objects = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_precision", Extension)) {
-				ExtensionData.ARB_shader_precision = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_vertex_attrib_64bit", Extension)) {
-				ExtensionData.ARB_vertex_attrib_64bit = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_viewport_array", Extension)) {
-				ExtensionData.ARB_viewport_array = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_cl_event", Extension)) {
-				ExtensionData.ARB_cl_event = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_debug_output", Extension)) {
-				ExtensionData.ARB_debug_output = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_robustness", Extension)) {
-				ExtensionData.ARB_robustness = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_shader_stencil_export", Extension)) {
-				ExtensionData.ARB_shader_stencil_export = true;
-				continue;
-			}
-			if(!strcmp("GL_ARB_base_instance", Extension)) {
-				ExtensionData.ARB_base_instance = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_shading_language_420pack", Extension)) {
-				ExtensionData.ARB_shading_language_420pack = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_transform_feedback_instanced", Extension)) {
-				ExtensionData.ARB_transform_feedback_instanced = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_compressed_texture_pixel_storage", Extension)) {
-				ExtensionData.ARB_compressed_texture_pixel_storage = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_conservative_depth", Extension)) {
-				ExtensionData.ARB_conservative_depth = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_internalformat_query", Extension)) {
-				ExtensionData.ARB_internalformat_query = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_map_buffer_alignment", Extension)) {
-				ExtensionData.ARB_map_buffer_alignment = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_shader_atomic_counters", Extension)) {
-				ExtensionData.ARB_shader_atomic_counters = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_shader_image_load_store", Extension)) {
-				ExtensionData.ARB_shader_image_load_store = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_shading_language_packing", Extension)) {
-				ExtensionData.ARB_shading_language_packing = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_texture_storage", Extension)) {
-				ExtensionData.ARB_texture_storage = true;
-				continue;
-			}
-			else if(!strcmp("GL_KHR_texture_compression_astc_hdr", Extension)) {
-				ExtensionData.KHR_texture_compression_astc_hdr = true;
-				continue;
-			}
-			else if(!strcmp("GL_KHR_texture_compression_astc_ldr", Extension)) {
-				ExtensionData.KHR_texture_compression_astc_ldr = true;
-				continue;
-			}
-			else if(!strcmp("GL_KHR_debug", Extension)) {
-				ExtensionData.KHR_debug = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_arrays_of_arrays", Extension)) {
-				ExtensionData.ARB_arrays_of_arrays = true;
-				continue;
-			}
-			else if(!strcmp("GL_ARB_clear_buffer_object", Extension))
-				ExtensionData.ARB_clear_buffer_object = true;
-			else if(!strcmp("GL_ARB_compute_shader", Extension))
-				ExtensionData.ARB_compute_shader = true;
-			else if(!strcmp("GL_ARB_copy_image", Extension))
-				ExtensionData.ARB_copy_image = true;
-			else if(!strcmp("GL_ARB_texture_view", Extension))
-				ExtensionData.ARB_texture_view = true;
-			else if(!strcmp("GL_ARB_vertex_attrib_binding", Extension))
-				ExtensionData.ARB_vertex_attrib_binding = true;
-			else if(!strcmp("GL_ARB_robustness_isolation", Extension))
-				ExtensionData.ARB_robustness_isolation = true;
-			else if(!strcmp("GL_ARB_robustness_isolation", Extension))
-				ExtensionData.ARB_robustness_isolation = true;
-			else if(!strcmp("GL_ARB_ES3_compatibility", Extension))
-				ExtensionData.ARB_ES3_compatibility = true;
-			else if(!strcmp("GL_ARB_explicit_uniform_location", Extension))
-				ExtensionData.ARB_explicit_uniform_location = true;
-			else if(!strcmp("GL_ARB_fragment_layer_viewport", Extension))
-				ExtensionData.ARB_fragment_layer_viewport = true;
-			else if(!strcmp("GL_ARB_framebuffer_no_attachments", Extension))
-				ExtensionData.ARB_framebuffer_no_attachments = true;
-			else if(!strcmp("GL_ARB_internalformat_query2", Extension))
-				ExtensionData.ARB_internalformat_query2 = true;
-			else if(!strcmp("GL_ARB_invalidate_subdata", Extension))
-				ExtensionData.ARB_invalidate_subdata = true;
-			else if(!strcmp("GL_ARB_multi_draw_indirect", Extension))
-				ExtensionData.ARB_multi_draw_indirect = true;
-			else if(!strcmp("GL_ARB_program_interface_query", Extension))
-				ExtensionData.ARB_program_interface_query = true;
-			else if(!strcmp("GL_ARB_robust_buffer_access_behavior", Extension))
-				ExtensionData.ARB_robust_buffer_access_behavior = true;
-			else if(!strcmp("GL_ARB_shader_image_size", Extension))
-				ExtensionData.ARB_shader_image_size = true;
-			else if(!strcmp("GL_ARB_shader_storage_buffer_object", Extension))
-				ExtensionData.ARB_shader_storage_buffer_object = true;
-			else if(!strcmp("GL_ARB_stencil_texturing", Extension))
-				ExtensionData.ARB_stencil_texturing = true;
-			else if(!strcmp("GL_ARB_texture_buffer_range", Extension))
-				ExtensionData.ARB_texture_buffer_range = true;
-			else if(!strcmp("GL_ARB_texture_query_levels", Extension))
-				ExtensionData.ARB_texture_query_levels = true;
-			else if(!strcmp("GL_ARB_texture_storage_multisample", Extension))
-				ExtensionData.ARB_texture_storage_multisample = true;
-			else if(!strcmp("GL_ARB_buffer_storage", Extension))
-				ExtensionData.ARB_buffer_storage = true;
-			else if(!strcmp("GL_ARB_clear_texture", Extension))
-				ExtensionData.ARB_clear_texture = true;
-			else if(!strcmp("GL_ARB_enhanced_layouts", Extension))
-				ExtensionData.ARB_enhanced_layouts = true;
-			else if(!strcmp("GL_ARB_multi_bind", Extension))
-				ExtensionData.ARB_multi_bind = true;
-			else if(!strcmp("GL_ARB_query_buffer_object", Extension))
-				ExtensionData.ARB_query_buffer_object = true;
-			else if(!strcmp("GL_ARB_texture_mirror_clamp_to_edge", Extension))
-				ExtensionData.ARB_texture_mirror_clamp_to_edge = true;
-			else if(!strcmp("GL_ARB_texture_stencil8", Extension))
-				ExtensionData.ARB_texture_stencil8 = true;
-			else if(!strcmp("GL_ARB_vertex_type_10f_11f_11f_rev", Extension))
-				ExtensionData.ARB_vertex_type_10f_11f_11f_rev = true;
-			else if(!strcmp("GL_ARB_bindless_texture", Extension))
-				ExtensionData.ARB_bindless_texture = true;
-			else if(!strcmp("GL_ARB_compute_variable_group_size", Extension))
-				ExtensionData.ARB_compute_variable_group_size = true;
-			else if(!strcmp("GL_ARB_indirect_parameters", Extension))
-				ExtensionData.ARB_indirect_parameters = true;
-			else if(!strcmp("GL_ARB_seamless_cubemap_per_texture", Extension))
-				ExtensionData.ARB_seamless_cubemap_per_texture = true;
-			else if(!strcmp("GL_ARB_shader_draw_parameters", Extension))
-				ExtensionData.ARB_shader_draw_parameters = true;
-			else if(!strcmp("GL_ARB_shader_group_vote", Extension))
-				ExtensionData.ARB_shader_group_vote = true;
-			else if(!strcmp("GL_ARB_sparse_texture", Extension))
-				ExtensionData.ARB_sparse_texture = true;
-			else if(!strcmp("GL_ARB_ES3_1_compatibility", Extension))
-				ExtensionData.ARB_ES3_1_compatibility = true;
-			else if(!strcmp("GL_ARB_clip_control", Extension))
-				ExtensionData.ARB_clip_control = true;
-			else if(!strcmp("GL_ARB_conditional_render_inverted", Extension))
-				ExtensionData.ARB_conditional_render_inverted = true;
-			else if(!strcmp("GL_ARB_derivative_control", Extension))
-				ExtensionData.ARB_derivative_control = true;
-			else if(!strcmp("GL_ARB_direct_state_access", Extension))
-				ExtensionData.ARB_direct_state_access = true;
-			else if(!strcmp("GL_ARB_get_texture_sub_image", Extension))
-				ExtensionData.ARB_get_texture_sub_image = true;
-			else if(!strcmp("GL_ARB_shader_texture_image_samples", Extension))
-				ExtensionData.ARB_shader_texture_image_samples = true;
-			else if(!strcmp("GL_ARB_texture_barrier", Extension))
-				ExtensionData.ARB_texture_barrier = true;
-			else if(!strcmp("GL_KHR_context_flush_control", Extension))
-				ExtensionData.KHR_context_flush_control = true;
-			else if(!strcmp("GL_KHR_robust_buffer_access_behavior", Extension))
-				ExtensionData.KHR_robust_buffer_access_behavior = true;
-			else if(!strcmp("GL_KHR_robustness", Extension))
-				ExtensionData.KHR_robustness = true;
-			else if(!strcmp("GL_ARB_pipeline_statistics_query", Extension))
-				ExtensionData.ARB_pipeline_statistics_query = true;
-			else if(!strcmp("GL_ARB_sparse_buffer", Extension))
-				ExtensionData.ARB_sparse_buffer = true;
-			else if(!strcmp("GL_ARB_transform_feedback_overflow_query", Extension))
-				ExtensionData.ARB_transform_feedback_overflow_query = true;
-
-			// EXT
-			if(!strcmp("GL_EXT_texture_compression_s3tc", Extension)) {
-				ExtensionData.EXT_texture_compression_s3tc = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_compression_latc", Extension)) {
-				ExtensionData.EXT_texture_compression_latc = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_transform_feedback", Extension)) {
-				ExtensionData.EXT_transform_feedback = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_direct_state_access", Extension)) {
-				ExtensionData.EXT_direct_state_access = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_filter_anisotropic", Extension)) {
-				ExtensionData.EXT_texture_filter_anisotropic = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_compression_s3tc", Extension)) {
-				ExtensionData.EXT_texture_compression_s3tc = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_array", Extension)) {
-				ExtensionData.EXT_texture_array = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_snorm", Extension)) {
-				ExtensionData.EXT_texture_snorm = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_texture_sRGB_decode", Extension)) {
-				ExtensionData.EXT_texture_sRGB_decode = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_framebuffer_multisample_blit_scaled", Extension)) {
-				ExtensionData.EXT_framebuffer_multisample_blit_scaled = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_shader_integer_mix", Extension)) {
-				ExtensionData.EXT_shader_integer_mix = true;
-				continue;
-			}
-			if(!strcmp("GL_EXT_polygon_offset_clamp", Extension)) {
-				ExtensionData.EXT_polygon_offset_clamp = true;
-				continue;
-			}
-
-			// NV
-			if(!strcmp("GL_NV_explicit_multisample", Extension)) {
-				ExtensionData.NV_explicit_multisample = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_shader_buffer_load", Extension)) {
-				ExtensionData.NV_shader_buffer_load = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_vertex_buffer_unified_memory", Extension)) {
-				ExtensionData.NV_vertex_buffer_unified_memory = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_shader_buffer_store", Extension)) {
-				ExtensionData.NV_shader_buffer_store = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_bindless_multi_draw_indirect", Extension)) {
-				ExtensionData.NV_bindless_multi_draw_indirect = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_blend_equation_advanced", Extension)) {
-				ExtensionData.NV_blend_equation_advanced = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_deep_texture3D", Extension)) {
-				ExtensionData.NV_deep_texture3D = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_shader_thread_group", Extension)) {
-				ExtensionData.NV_shader_thread_group = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_shader_thread_shuffle", Extension)) {
-				ExtensionData.NV_shader_thread_shuffle = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_shader_atomic_int64", Extension)) {
-				ExtensionData.NV_shader_atomic_int64 = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_bindless_multi_draw_indirect_count", Extension)) {
-				ExtensionData.NV_bindless_multi_draw_indirect_count = true;
-				continue;
-			}
-			if(!strcmp("GL_NV_uniform_buffer_unified_memory", Extension)) {
-				ExtensionData.NV_uniform_buffer_unified_memory = true;
-				continue;
-			}
-
-			// AMD
-
-			if(!strcmp("GL_ATI_texture_compression_3dc", Extension)) {
-				ExtensionData.ATI_texture_compression_3dc = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_depth_clamp_separate", Extension)) {
-				ExtensionData.AMD_depth_clamp_separate = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_stencil_operation_extended", Extension)) {
-				ExtensionData.AMD_stencil_operation_extended = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_vertex_shader_viewport_index", Extension)) {
-				ExtensionData.AMD_vertex_shader_viewport_index = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_vertex_shader_layer", Extension)) {
-				ExtensionData.AMD_vertex_shader_layer = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_shader_trinary_minmax", Extension)) {
-				ExtensionData.AMD_shader_trinary_minmax = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_interleaved_elements", Extension)) {
-				ExtensionData.AMD_interleaved_elements = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_shader_atomic_counter_ops", Extension)) {
-				ExtensionData.AMD_shader_atomic_counter_ops = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_shader_stencil_value_export", Extension)) {
-				ExtensionData.AMD_shader_stencil_value_export = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_transform_feedback4", Extension)) {
-				ExtensionData.AMD_transform_feedback4 = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_gpu_shader_int64", Extension)) {
-				ExtensionData.AMD_gpu_shader_int64 = true;
-				continue;
-			}
-			if(!strcmp("GL_AMD_gcn_shader", Extension)) {
-				ExtensionData.AMD_gcn_shader = true;
-				continue;
-			}
-
-			// Intel
-			if(!strcmp("GL_INTEL_map_texture", Extension)) {
-				ExtensionData.INTEL_map_texture = true;
-				continue;
-			}
-			if(!strcmp("GL_INTEL_fragment_shader_ordering", Extension)) {
-				ExtensionData.INTEL_fragment_shader_ordering = true;
-				continue;
-			}
-			if(!strcmp("GL_INTEL_performance_query", Extension)) {
-				ExtensionData.INTEL_performance_query = true;
-				continue;
-			}
-		}
+		extensionName const Key = {Extension->c_str(), extension::COUNT};
+		std::vector<extensionName>::const_iterator const It = std::lower_bound(Names.begin(), Names.end(), Key);
+		if(It != Names.end() && *Extension == It->Name)
+			this->setExtension(It->Extension);
 	}
 }
 
+bool caps::isSupported(char const * Name) const
+{
+	return this->SupportedExtensions.isSupported(Name);
+}
+
 void caps::initDebug()
 {
 	memset(&DebugData, 0, sizeof(DebugData));
@@ -1366,6 +755,7 @@ void caps::initFormats()
 
 caps::caps(profile const & Profile) :
 	VersionData(Profile),
+	SupportedExtensions(Profile == CORE),
 	Version(VersionData),
 	Extensions(ExtensionData),
 	Debug(DebugData),
@@ -1373,8 +763,9 @@ caps::caps(profile const & Profile) :
 	Values(ValuesData),
 	Formats(FormatsData)
 {
-	this->initVersion();
+	// initVersion reads the extensions
 	this->initExtensions();
+	this->initVersion();
 	this->initDebug();
 	this->initLimits();
 	this->initValues();
@@ -25,6 +25,22 @@
 
 #include "test.hpp"
 #include <string>
+#include <unordered_set>
+
+// Extension strings exposed by the current context, queried without the other capabilities
+class extensionSet
+{
+public:
+	// Indexed queries with glGetStringi for core profiles, the space separated GL_EXTENSIONS string
+	// for compatibility and ES profiles where glGetStringi may not exist
+	explicit extensionSet(bool Indexed);
+
+	bool isSupported(char const * Name) const;
+	std::unordered_set<std::string> const & getNames() const{return this->Names;}
+
+private:
+	std::unordered_set<std::string> Names;
+};
 
 struct caps
 {
@@ -35,6 +51,15 @@ struct caps
 		ES = 0x00000004
 	};
 
+	// Compile time identifiers of the extensions known by caps
+	enum class extension
+	{
+#		define CAPS_EXTENSION(Name) Name,
+#		include "caps_extensions.inl"
+#		undef CAPS_EXTENSION
+		COUNT
+	};
+
 private:
 	bool check(GLint MajorVersionRequire, GLint MinorVersionRequire);
 
@@ -83,212 +108,15 @@ private:
 
 	struct extensions
 	{
-		bool ARB_multitexture;
-		bool ARB_transpose_matrix;
-		bool ARB_multisample;
-		bool ARB_texture_env_add;
-		bool ARB_texture_cube_map;
-		bool ARB_texture_compression;
-		bool ARB_texture_border_clamp;
-		bool ARB_point_parameters;
-		bool ARB_vertex_blend;
-		bool ARB_matrix_palette;
-		bool ARB_texture_env_combine;
-		bool ARB_texture_env_crossbar;
-		bool ARB_texture_env_dot3;
-		bool ARB_texture_mirrored_repeat;
-		bool ARB_depth_texture;
-		bool ARB_shadow;
-		bool ARB_shadow_ambient;
-		bool ARB_window_pos;
-		bool ARB_vertex_program;
-		bool ARB_fragment_program;
-		bool ARB_vertex_buffer_object;
-		bool ARB_occlusion_query;
-		bool ARB_shader_objects;
-		bool ARB_vertex_shader;
-		bool ARB_fragment_shader;
-		bool ARB_shading_language_100;
-		bool ARB_texture_non_power_of_two;
-		bool ARB_point_sprite;
-		bool ARB_fragment_program_shadow;
-		bool ARB_draw_buffers;
-		bool ARB_texture_rectangle;
-		bool ARB_color_buffer_float;
-		bool ARB_half_float_pixel;
-		bool ARB_texture_float;
-		bool ARB_pixel_buffer_object;
-		bool ARB_depth_buffer_float;
-		bool ARB_draw_instanced;
-		bool ARB_framebuffer_object;
-		bool ARB_framebuffer_sRGB;
-		bool ARB_geometry_shader4;
-		bool ARB_half_float_vertex;
-		bool ARB_instanced_arrays;
-		bool ARB_map_buffer_range;
-		bool ARB_texture_buffer_object;
-		bool ARB_texture_compression_rgtc;
-		bool ARB_texture_rg;
-		bool ARB_vertex_array_object;
-		bool ARB_uniform_buffer_object;
-		bool ARB_compatibility;
-		bool ARB_copy_buffer;
-		bool ARB_shader_texture_lod;
-		bool ARB_depth_clamp;
-		bool ARB_draw_elements_base_vertex;
-		bool ARB_fragment_coord_conventions;
-		bool ARB_provoking_vertex;
-		bool ARB_seamless_cube_map;
-		bool ARB_sync;
-		bool ARB_texture_multisample;
-		bool ARB_vertex_array_bgra;
-		bool ARB_draw_buffers_blend;
-		bool ARB_sample_shading;
-		bool ARB_texture_cube_map_array;
-		bool ARB_texture_gather;
-		bool ARB_texture_query_lod;
-		bool ARB_shading_language_include;
-		bool ARB_texture_compression_bptc;
-		bool ARB_blend_func_extended;
-		bool ARB_explicit_attrib_location;
-		bool ARB_occlusion_query2;
-		bool ARB_sampler_objects;
-		bool ARB_shader_bit_encoding;
-		bool ARB_texture_rgb10_a2ui;
-		bool ARB_texture_swizzle;
-		bool ARB_timer_query;
-		bool ARB_vertex_type_2_10_10_10_rev;
-		bool ARB_draw_indirect;
-		bool ARB_gpu_shader5;
-		bool ARB_gpu_shader_fp64;
-		bool ARB_shader_subroutine;
-		bool ARB_tessellation_shader;
-		bool ARB_texture_buffer_object_rgb32;
-		bool ARB_transform_feedback2;
-		bool ARB_transform_feedback3;
-		bool ARB_ES2_compatibility;
-		bool ARB_get_program_binary;
-		bool ARB_separate_shader_objects;
-		bool ARB_shader_precision;
-		bool ARB_vertex_attrib_64bit;
-		bool ARB_viewport_array;
-		bool ARB_cl_event;
-		bool ARB_debug_output;
-		bool ARB_robustness;
-		bool ARB_shader_stencil_export;
-		bool ARB_base_instance;
-		bool ARB_shading_language_420pack;
-		bool ARB_transform_feedback_instanced;
-		bool ARB_compressed_texture_pixel_storage;
-		bool ARB_conservative_depth;
-		bool ARB_internalformat_query;
-		bool ARB_map_buffer_alignment;
-		bool ARB_shader_atomic_counters;
-		bool ARB_shader_image_load_store;
-		bool ARB_shading_language_packing;
-		bool ARB_texture_storage;
-		bool KHR_texture_compression_astc_hdr;
-		bool KHR_texture_compression_astc_ldr;
-		bool KHR_debug;
-		bool ARB_arrays_of_arrays;
-		bool ARB_clear_buffer_object;
-		bool ARB_compute_shader;
-		bool ARB_copy_image;
-		bool ARB_texture_view;
-		bool ARB_vertex_attrib_binding;
-		bool ARB_robustness_isolation;
-		bool ARB_ES3_compatibility;
-		bool ARB_explicit_uniform_location;
-		bool ARB_fragment_layer_viewport;
-		bool ARB_framebuffer_no_attachments;
-		bool ARB_internalformat_query2;
-		bool ARB_invalidate_subdata;
-		bool ARB_multi_draw_indirect;
-		bool ARB_program_interface_query;
-		bool ARB_robust_buffer_access_behavior;
-		bool ARB_shader_image_size;
-		bool ARB_shader_storage_buffer_object;
-		bool ARB_stencil_texturing;
-		bool ARB_texture_buffer_range;
-		bool ARB_texture_query_levels;
-		bool ARB_texture_storage_multisample;
-		bool ARB_buffer_storage;
-		bool ARB_clear_texture;
-		bool ARB_enhanced_layouts;
-		bool ARB_multi_bind;
-		bool ARB_query_buffer_object;
-		bool ARB_texture_mirror_clamp_to_edge;
-		bool ARB_texture_stencil8;
-		bool ARB_vertex_type_10f_11f_11f_rev;
-		bool ARB_bindless_texture;
-		bool ARB_compute_variable_group_size;
-		bool ARB_indirect_parameters;
-		bool ARB_seamless_cubemap_per_texture;
-		bool ARB_shader_draw_parameters;
-		bool ARB_shader_group_vote;
-		bool ARB_sparse_texture;
-		bool ARB_ES3_1_compatibility;
-		bool ARB_clip_control;
-		bool ARB_conditional_render_inverted;
-		bool ARB_cull_distance;
-		bool ARB_derivative_control;
-		bool ARB_direct_state_access;
-		bool ARB_get_texture_sub_image;
-		bool ARB_shader_texture_image_samples;
-		bool ARB_texture_barrier;
-		bool KHR_context_flush_control;
-		bool KHR_robust_buffer_access_behavior;
-		bool KHR_robustness;
-		bool ARB_pipeline_statistics_query;
-		bool ARB_sparse_buffer;
-		bool ARB_transform_feedback_overflow_query;
-
-		bool EXT_texture_compression_latc;
-		bool EXT_transform_feedback;
-		bool EXT_direct_state_access;
-		bool EXT_texture_filter_anisotropic;
-		bool EXT_texture_compression_s3tc;
-		bool EXT_texture_array;
-		bool EXT_texture_snorm;
-		bool EXT_texture_sRGB_decode;
-		bool EXT_framebuffer_multisample_blit_scaled;
-		bool EXT_shader_integer_mix;
-		bool EXT_shader_image_load_formatted;
-		bool EXT_polygon_offset_clamp;
-
-		bool NV_explicit_multisample;
-		bool NV_shader_buffer_load;
-		bool NV_vertex_buffer_unified_memory;
-		bool NV_shader_buffer_store;
-		bool NV_bindless_multi_draw_indirect;
-		bool NV_blend_equation_advanced;
-		bool NV_deep_texture3D;
-		bool NV_shader_thread_group;
-		bool NV_shader_thread_shuffle;
-		bool NV_shader_atomic_int64;
-		bool NV_bindless_multi_draw_indirect_count;
-		bool NV_uniform_buffer_unified_memory;
-
-		bool ATI_texture_compression_3dc;
-		bool AMD_depth_clamp_separate;
-		bool AMD_stencil_operation_extended;
-		bool AMD_vertex_shader_viewport_index;
-		bool AMD_vertex_shader_layer;
-		bool AMD_shader_trinary_minmax;
-		bool AMD_interleaved_elements;
-		bool AMD_shader_atomic_counter_ops;
-		bool AMD_occlusion_query_event;
-		bool AMD_shader_stencil_value_export;
-		bool AMD_transform_feedback4;
-		bool AMD_gpu_shader_int64;
-		bool AMD_gcn_shader;
-
-		bool INTEL_map_texture;
-		bool INTEL_fragment_shader_ordering;
-		bool INTEL_performance_query;
+#		define CAPS_EXTENSION(Name) bool Name : 1;
+#		include "caps_extensions.inl"
+#		undef CAPS_EXTENSION
 	} ExtensionData;
 
 	void initExtensions();
+	void setExtension(extension Extension);
+
+	extensionSet SupportedExtensions;
 
 	struct debug
 	{
@@ -548,6 +376,9 @@ private:
 public:
 	caps(profile const & Profile);
 
+	// Any extension string exposed by the context, including the ones unknown by caps
+	bool isSupported(char const * Name) const;
+
 	version const & Version;
 	extensions const & Extensions;
 	debug const & Debug;
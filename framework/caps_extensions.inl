@@ -0,0 +1,200 @@
+// Extensions known by caps, in the order of caps::extensions. Each entry is the extension string without its GL_ prefix.
+CAPS_EXTENSION(ARB_multitexture)
+CAPS_EXTENSION(ARB_transpose_matrix)
+CAPS_EXTENSION(ARB_multisample)
+CAPS_EXTENSION(ARB_texture_env_add)
+CAPS_EXTENSION(ARB_texture_cube_map)
+CAPS_EXTENSION(ARB_texture_compression)
+CAPS_EXTENSION(ARB_texture_border_clamp)
+CAPS_EXTENSION(ARB_point_parameters)
+CAPS_EXTENSION(ARB_vertex_blend)
+CAPS_EXTENSION(ARB_matrix_palette)
+CAPS_EXTENSION(ARB_texture_env_combine)
+CAPS_EXTENSION(ARB_texture_env_crossbar)
+CAPS_EXTENSION(ARB_texture_env_dot3)
+CAPS_EXTENSION(ARB_texture_mirrored_repeat)
+CAPS_EXTENSION(ARB_depth_texture)
+CAPS_EXTENSION(ARB_shadow)
+CAPS_EXTENSION(ARB_shadow_ambient)
+CAPS_EXTENSION(ARB_window_pos)
+CAPS_EXTENSION(ARB_vertex_program)
+CAPS_EXTENSION(ARB_fragment_program)
+CAPS_EXTENSION(ARB_vertex_buffer_object)
+CAPS_EXTENSION(ARB_occlusion_query)
+CAPS_EXTENSION(ARB_shader_objects)
+CAPS_EXTENSION(ARB_vertex_shader)
+CAPS_EXTENSION(ARB_fragment_shader)
+CAPS_EXTENSION(ARB_shading_language_100)
+CAPS_EXTENSION(ARB_texture_non_power_of_two)
+CAPS_EXTENSION(ARB_point_sprite)
+CAPS_EXTENSION(ARB_fragment_program_shadow)
+CAPS_EXTENSION(ARB_draw_buffers)
+CAPS_EXTENSION(ARB_texture_rectangle)
+CAPS_EXTENSION(ARB_color_buffer_float)
+CAPS_EXTENSION(ARB_half_float_pixel)
+CAPS_EXTENSION(ARB_texture_float)
+CAPS_EXTENSION(ARB_pixel_buffer_object)
+CAPS_EXTENSION(ARB_depth_buffer_float)
+CAPS_EXTENSION(ARB_draw_instanced)
+CAPS_EXTENSION(ARB_framebuffer_object)
+CAPS_EXTENSION(ARB_framebuffer_sRGB)
+CAPS_EXTENSION(ARB_geometry_shader4)
+CAPS_EXTENSION(ARB_half_float_vertex)
+CAPS_EXTENSION(ARB_instanced_arrays)
+CAPS_EXTENSION(ARB_map_buffer_range)
+CAPS_EXTENSION(ARB_texture_buffer_object)
+CAPS_EXTENSION(ARB_texture_compression_rgtc)
+CAPS_EXTENSION(ARB_texture_rg)
+CAPS_EXTENSION(ARB_vertex_array_object)
+CAPS_EXTENSION(ARB_uniform_buffer_object)
+CAPS_EXTENSION(ARB_compatibility)
+CAPS_EXTENSION(ARB_copy_buffer)
+CAPS_EXTENSION(ARB_shader_texture_lod)
+CAPS_EXTENSION(ARB_depth_clamp)
+CAPS_EXTENSION(ARB_draw_elements_base_vertex)
+CAPS_EXTENSION(ARB_fragment_coord_conventions)
+CAPS_EXTENSION(ARB_provoking_vertex)
+CAPS_EXTENSION(ARB_seamless_cube_map)
+CAPS_EXTENSION(ARB_sync)
+CAPS_EXTENSION(ARB_texture_multisample)
+CAPS_EXTENSION(ARB_vertex_array_bgra)
+CAPS_EXTENSION(ARB_draw_buffers_blend)
+CAPS_EXTENSION(ARB_sample_shading)
+CAPS_EXTENSION(ARB_texture_cube_map_array)
+CAPS_EXTENSION(ARB_texture_gather)
+CAPS_EXTENSION(ARB_texture_query_lod)
+CAPS_EXTENSION(ARB_shading_language_include)
+CAPS_EXTENSION(ARB_texture_compression_bptc)
+CAPS_EXTENSION(ARB_blend_func_extended)
+CAPS_EXTENSION(ARB_explicit_attrib_location)
+CAPS_EXTENSION(ARB_occlusion_query2)
+CAPS_EXTENSION(ARB_sampler_objects)
+CAPS_EXTENSION(ARB_shader_bit_encoding)
+CAPS_EXTENSION(ARB_texture_rgb10_a2ui)
+CAPS_EXTENSION(ARB_texture_swizzle)
+CAPS_EXTENSION(ARB_timer_query)
+CAPS_EXTENSION(ARB_vertex_type_2_10_10_10_rev)
+CAPS_EXTENSION(ARB_draw_indirect)
+CAPS_EXTENSION(ARB_gpu_shader5)
+CAPS_EXTENSION(ARB_gpu_shader_fp64)
+CAPS_EXTENSION(ARB_shader_subroutine)
+CAPS_EXTENSION(ARB_tessellation_shader)
+CAPS_EXTENSION(ARB_texture_buffer_object_rgb32)
+CAPS_EXTENSION(ARB_transform_feedback2)
+CAPS_EXTENSION(ARB_transform_feedback3)
+CAPS_EXTENSION(ARB_ES2_compatibility)
+CAPS_EXTENSION(ARB_get_program_binary)
+CAPS_EXTENSION(ARB_separate_shader_objects)
+CAPS_EXTENSION(ARB_shader_precision)
+CAPS_EXTENSION(ARB_vertex_attrib_64bit)
+CAPS_EXTENSION(ARB_viewport_array)
+CAPS_EXTENSION(ARB_cl_event)
+CAPS_EXTENSION(ARB_debug_output)
+CAPS_EXTENSION(ARB_robustness)
+CAPS_EXTENSION(ARB_shader_stencil_export)
+CAPS_EXTENSION(ARB_base_instance)
+CAPS_EXTENSION(ARB_shading_language_420pack)
+CAPS_EXTENSION(ARB_transform_feedback_instanced)
+CAPS_EXTENSION(ARB_compressed_texture_pixel_storage)
+CAPS_EXTENSION(ARB_conservative_depth)
+CAPS_EXTENSION(ARB_internalformat_query)
+CAPS_EXTENSION(ARB_map_buffer_alignment)
+CAPS_EXTENSION(ARB_shader_atomic_counters)
+CAPS_EXTENSION(ARB_shader_image_load_store)
+CAPS_EXTENSION(ARB_shading_language_packing)
+CAPS_EXTENSION(ARB_texture_storage)
+CAPS_EXTENSION(KHR_texture_compression_astc_hdr)
+CAPS_EXTENSION(KHR_texture_compression_astc_ldr)
+CAPS_EXTENSION(KHR_debug)
+CAPS_EXTENSION(ARB_arrays_of_arrays)
+CAPS_EXTENSION(ARB_clear_buffer_object)
+CAPS_EXTENSION(ARB_compute_shader)
+CAPS_EXTENSION(ARB_copy_image)
+CAPS_EXTENSION(ARB_texture_view)
+CAPS_EXTENSION(ARB_vertex_attrib_binding)
+CAPS_EXTENSION(ARB_robustness_isolation)
+CAPS_EXTENSION(ARB_ES3_compatibility)
+CAPS_EXTENSION(ARB_explicit_uniform_location)
+CAPS_EXTENSION(ARB_fragment_layer_viewport)
+CAPS_EXTENSION(ARB_framebuffer_no_attachments)
+CAPS_EXTENSION(ARB_internalformat_query2)
+CAPS_EXTENSION(ARB_invalidate_subdata)
+CAPS_EXTENSION(ARB_multi_draw_indirect)
+CAPS_EXTENSION(ARB_program_interface_query)
+CAPS_EXTENSION(ARB_robust_buffer_access_behavior)
+CAPS_EXTENSION(ARB_shader_image_size)
+CAPS_EXTENSION(ARB_shader_storage_buffer_object)
+CAPS_EXTENSION(ARB_stencil_texturing)
+CAPS_EXTENSION(ARB_texture_buffer_range)
+CAPS_EXTENSION(ARB_texture_query_levels)
+CAPS_EXTENSION(ARB_texture_storage_multisample)
+CAPS_EXTENSION(ARB_buffer_storage)
+CAPS_EXTENSION(ARB_clear_texture)
+CAPS_EXTENSION(ARB_enhanced_layouts)
+CAPS_EXTENSION(ARB_multi_bind)
+CAPS_EXTENSION(ARB_query_buffer_object)
+CAPS_EXTENSION(ARB_texture_mirror_clamp_to_edge)
+CAPS_EXTENSION(ARB_texture_stencil8)
+CAPS_EXTENSION(ARB_vertex_type_10f_11f_11f_rev)
+CAPS_EXTENSION(ARB_bindless_texture)
+CAPS_EXTENSION(ARB_compute_variable_group_size)
+CAPS_EXTENSION(ARB_indirect_parameters)
+CAPS_EXTENSION(ARB_seamless_cubemap_per_texture)
+CAPS_EXTENSION(ARB_shader_draw_parameters)
+CAPS_EXTENSION(ARB_shader_group_vote)
+CAPS_EXTENSION(ARB_sparse_texture)
+CAPS_EXTENSION(ARB_ES3_1_compatibility)
+CAPS_EXTENSION(ARB_clip_control)
+CAPS_EXTENSION(ARB_conditional_render_inverted)
+CAPS_EXTENSION(ARB_cull_distance)
+CAPS_EXTENSION(ARB_derivative_control)
+CAPS_EXTENSION(ARB_direct_state_access)
+CAPS_EXTENSION(ARB_get_texture_sub_image)
+CAPS_EXTENSION(ARB_shader_texture_image_samples)
+CAPS_EXTENSION(ARB_texture_barrier)
+CAPS_EXTENSION(KHR_context_flush_control)
+CAPS_EXTENSION(KHR_robust_buffer_access_behavior)
+CAPS_EXTENSION(KHR_robustness)
+CAPS_EXTENSION(ARB_pipeline_statistics_query)
+CAPS_EXTENSION(ARB_sparse_buffer)
+CAPS_EXTENSION(ARB_transform_feedback_overflow_query)
+CAPS_EXTENSION(EXT_texture_compression_latc)
+CAPS_EXTENSION(EXT_transform_feedback)
+CAPS_EXTENSION(EXT_direct_state_access)
+CAPS_EXTENSION(EXT_texture_filter_anisotropic)
+CAPS_EXTENSION(EXT_texture_compression_s3tc)
+CAPS_EXTENSION(EXT_texture_array)
+CAPS_EXTENSION(EXT_texture_snorm)
+CAPS_EXTENSION(EXT_texture_sRGB_decode)
+CAPS_EXTENSION(EXT_framebuffer_multisample_blit_scaled)
+CAPS_EXTENSION(EXT_shader_integer_mix)
+CAPS_EXTENSION(EXT_shader_image_load_formatted)
+CAPS_EXTENSION(EXT_polygon_offset_clamp)
+CAPS_EXTENSION(NV_explicit_multisample)
+CAPS_EXTENSION(NV_shader_buffer_load)
+CAPS_EXTENSION(NV_vertex_buffer_unified_memory)
+CAPS_EXTENSION(NV_shader_buffer_store)
+CAPS_EXTENSION(NV_bindless_multi_draw_indirect)
+CAPS_EXTENSION(NV_blend_equation_advanced)
+CAPS_EXTENSION(NV_deep_texture3D)
+CAPS_EXTENSION(NV_shader_thread_group)
+CAPS_EXTENSION(NV_shader_thread_shuffle)
+CAPS_EXTENSION(NV_shader_atomic_int64)
+CAPS_EXTENSION(NV_bindless_multi_draw_indirect_count)
+CAPS_EXTENSION(NV_uniform_buffer_unified_memory)
+CAPS_EXTENSION(ATI_texture_compression_3dc)
+CAPS_EXTENSION(AMD_depth_clamp_separate)
+CAPS_EXTENSION(AMD_stencil_operation_extended)
+CAPS_EXTENSION(AMD_vertex_shader_viewport_index)
+CAPS_EXTENSION(AMD_vertex_shader_layer)
+CAPS_EXTENSION(AMD_shader_trinary_minmax)
+CAPS_EXTENSION(AMD_interleaved_elements)
+CAPS_EXTENSION(AMD_shader_atomic_counter_ops)
+CAPS_EXTENSION(AMD_occlusion_query_event)
+CAPS_EXTENSION(AMD_shader_stencil_value_export)
+CAPS_EXTENSION(AMD_transform_feedback4)
+CAPS_EXTENSION(AMD_gpu_shader_int64)
+CAPS_EXTENSION(AMD_gcn_shader)
+CAPS_EXTENSION(INTEL_map_texture)
+CAPS_EXTENSION(INTEL_fragment_shader_ordering)
+CAPS_EXTENSION(INTEL_performance_query)
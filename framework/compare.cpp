@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "compare.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define OGL_SAMPLES_SSE2
+#	include <emmintrin.h>
+#endif
+
+namespace
+{
+	// Lowest common multiple of 3 and 4 components: the channel pattern repeats every block
+	std::size_t const BLOCK_SIZE = 48;
+
+	struct accumulator
+	{
+		accumulator() :
+			ErrorCount(0),
+			SquareSum(0)
+		{}
+
+		std::size_t ErrorCount;
+		glm::uint64 SquareSum;
+	};
+
+	void compareScalar(
+		glm::u8 const * Texture, std::size_t TextureComponents,
+		glm::u8 const * Template, std::size_t TemplateComponents,
+		std::size_t PixelCount, glm::u8vec3 const & Tolerance,
+		bool AccumulateSquare, accumulator & Accumulator)
+	{
+		for(std::size_t PixelIndex = 0; PixelIndex < PixelCount; ++PixelIndex)
+		{
+			bool Differ = false;
+			for(glm::length_t Channel = 0; Channel < 3; ++Channel)
+			{
+				int const Diff = std::abs(
+					static_cast<int>(Texture[PixelIndex * TextureComponents + Channel]) -
+					static_cast<int>(Template[PixelIndex * TemplateComponents + Channel]));
+
+				if(AccumulateSquare)
+					Accumulator.SquareSum += static_cast<glm::uint64>(Diff * Diff);
+				Differ = Differ || Diff > static_cast<int>(Tolerance[Channel]);
+			}
+
+			if(Differ)
+				++Accumulator.ErrorCount;
+		}
+	}
+
+#	if defined(OGL_SAMPLES_SSE2)
+	// Compare 16 bytes at once, only the blocks with channels outside the tolerance are rescanned to count pixels
+	std::size_t compareSSE2(
+		glm::u8 const * Texture, glm::u8 const * Template, std::size_t Components,
+		std::size_t Size, glm::u8vec3 const & Tolerance, accumulator & Accumulator)
+	{
+		glm::u8 TolerancePattern[BLOCK_SIZE];
+		glm::u8 MaskPattern[BLOCK_SIZE];
+		for(std::size_t i = 0; i < BLOCK_SIZE; ++i)
+		{
+			std::size_t const Channel = i % Components;
+			TolerancePattern[i] = Channel < 3 ? Tolerance[static_cast<glm::length_t>(Channel)] : 0;
+			MaskPattern[i] = Channel < 3 ? 0xFF : 0x00;
+		}
+
+		__m128i ToleranceBlock[3];
+		__m128i MaskBlock[3];
+		for(std::size_t i = 0; i < 3; ++i)
+		{
+			ToleranceBlock[i] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(TolerancePattern + i * 16));
+			MaskBlock[i] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(MaskPattern + i * 16));
+		}
+
+		__m128i const Zero = _mm_setzero_si128();
+		__m128i SquareSum = _mm_setzero_si128();
+
+		std::size_t const BlockCount = Size / BLOCK_SIZE;
+		for(std::size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+		{
+			glm::u8 const * TextureBlock = Texture + BlockIndex * BLOCK_SIZE;
+			glm::u8 const * TemplateBlock = Template + BlockIndex * BLOCK_SIZE;
+
+			int Exceeded = 0;
+			__m128i BlockSquareSum = _mm_setzero_si128();
+			for(std::size_t i = 0; i < 3; ++i)
+			{
+				__m128i const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(TextureBlock + i * 16));
+				__m128i const B = _mm_loadu_si128(reinterpret_cast<__m128i const *>(TemplateBlock + i * 16));
+				__m128i const Diff = _mm_and_si128(_mm_or_si128(_mm_subs_epu8(A, B), _mm_subs_epu8(B, A)), MaskBlock[i]);
+
+				Exceeded |= _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(Diff, ToleranceBlock[i]), Zero)) ^ 0xFFFF;
+
+				__m128i const DiffLow = _mm_unpacklo_epi8(Diff, Zero);
+				__m128i const DiffHigh = _mm_unpackhi_epi8(Diff, Zero);
+				BlockSquareSum = _mm_add_epi32(BlockSquareSum, _mm_add_epi32(_mm_madd_epi16(DiffLow, DiffLow), _mm_madd_epi16(DiffHigh, DiffHigh)));
+			}
+
+			// A block sums at most 6 squares per 32 bits lane, widen before it could overflow
+			SquareSum = _mm_add_epi64(SquareSum, _mm_add_epi64(_mm_unpacklo_epi32(BlockSquareSum, Zero), _mm_unpackhi_epi32(BlockSquareSum, Zero)));
+
+			if(Exceeded)
+				compareScalar(TextureBlock, Components, TemplateBlock, Components, BLOCK_SIZE / Components, Tolerance, false, Accumulator);
+		}
+
+		glm::uint64 SquareSumLanes[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(SquareSumLanes), SquareSum);
+		Accumulator.SquareSum += SquareSumLanes[0] + SquareSumLanes[1];
+
+		return BlockCount * BLOCK_SIZE;
+	}
+#	endif//OGL_SAMPLES_SSE2
+}//namespace
+
+compare_result compare_rgb(gli::texture2D const & Texture, gli::texture2D const & Template, glm::u8vec3 const & Tolerance)
+{
+	assert(Texture.dimensions() == Template.dimensions());
+	assert(Texture.format() == gli::FORMAT_RGB8_UNORM || Texture.format() == gli::FORMAT_RGBA8_UNORM);
+	assert(Template.format() == gli::FORMAT_RGB8_UNORM || Template.format() == gli::FORMAT_RGBA8_UNORM);
+
+	std::size_t const TextureComponents = gli::component_count(Texture.format());
+	std::size_t const TemplateComponents = gli::component_count(Template.format());
+	std::size_t const PixelCount = static_cast<std::size_t>(Texture.dimensions().x) * static_cast<std::size_t>(Texture.dimensions().y);
+
+	glm::u8 const * TextureData = Texture.data<glm::u8>();
+	glm::u8 const * TemplateData = Template.data<glm::u8>();
+
+	accumulator Accumulator;
+	std::size_t PixelOffset = 0;
+
+#	if defined(OGL_SAMPLES_SSE2)
+	if(TextureComponents == TemplateComponents)
+		PixelOffset = compareSSE2(TextureData, TemplateData, TextureComponents, PixelCount * TextureComponents, Tolerance, Accumulator) / TextureComponents;
+#	endif//OGL_SAMPLES_SSE2
+
+	// Remaining pixels and mixed RGB / RGBA layouts, stripping alpha on the fly
+	compareScalar(
+		TextureData + PixelOffset * TextureComponents, TextureComponents,
+		TemplateData + PixelOffset * TemplateComponents, TemplateComponents,
+		PixelCount - PixelOffset, Tolerance, true, Accumulator);
+
+	compare_result Result;
+	Result.ErrorCount = Accumulator.ErrorCount;
+
+	double const MeanSquare = PixelCount ? static_cast<double>(Accumulator.SquareSum) / static_cast<double>(PixelCount * 3) : 0.0;
+	Result.PSNR = MeanSquare > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / MeanSquare) : std::numeric_limits<double>::infinity();
+
+	return Result;
+}
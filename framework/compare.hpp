@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#include <gli/gli.hpp>
+#include <cstddef>
+
+struct compare_result
+{
+	compare_result() :
+		ErrorCount(0),
+		PSNR(0.0)
+	{}
+
+	// Number of pixels with at least one color channel outside the tolerance
+	std::size_t ErrorCount;
+	// Peak signal-to-noise ratio of the color channels in dB, infinity when identical
+	double PSNR;
+};
+
+// Compare the RGB channels of two RGB8 or RGBA8 textures of the same dimensions, alpha is ignored.
+// A channel differs when the absolute difference is greater than the tolerance of that channel.
+compare_result compare_rgb(gli::texture2D const & Texture, gli::texture2D const & Template, glm::u8vec3 const & Tolerance);
@@ -10,6 +10,7 @@
 //**********************************
 
 #include "compiler.hpp"
+#include "caps.hpp"
 
 #include <glm/gtc/random.hpp>
 
@@ -17,8 +18,208 @@
 #include <sstream>
 #include <fstream>
 #include <cstdarg>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <sys/stat.h>
 
 std::string getDataDirectory();
+std::string getBinaryDirectory();
+
+namespace
+{
+	// FNV-1a
+	glm::uint64 hashData(void const * Data, std::size_t Size)
+	{
+		glm::uint8 const * Bytes = static_cast<glm::uint8 const *>(Data);
+
+		glm::uint64 Hash = 14695981039346656037ull;
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	glm::uint64 hashSource(std::string const & Source)
+	{
+		return hashData(Source.data(), Source.size());
+	}
+
+	struct file
+	{
+		file() :
+			Exists(false),
+			Time(0),
+			Size(0),
+			Hash(0)
+		{}
+
+		bool Exists;
+		long long Time;
+		long long Size;
+		glm::uint64 Hash;
+		std::string Source;
+	};
+
+	struct preprocessed
+	{
+		std::string Text;
+		std::vector<std::pair<std::string, glm::uint64> > Dependencies;
+	};
+
+	std::map<std::string, file> FileCache;
+	std::map<std::string, preprocessed> SourceCache;
+
+	// Files are only read again when their modification time or size changed
+	file const & loadCachedFile(std::string const & Filename)
+	{
+		file & File = FileCache[Filename];
+
+		struct stat Stat;
+		if(stat(Filename.c_str(), &Stat) != 0)
+		{
+			File = file();
+			return File;
+		}
+
+		if(File.Exists && File.Time == static_cast<long long>(Stat.st_mtime) && File.Size == static_cast<long long>(Stat.st_size))
+			return File;
+
+		File.Source = loadFile(Filename);
+		File.Exists = true;
+		File.Time = static_cast<long long>(Stat.st_mtime);
+		File.Size = static_cast<long long>(Stat.st_size);
+		File.Hash = hashSource(File.Source);
+		return File;
+	}
+
+	bool isSourceDumpRequested()
+	{
+		char const * Environment = getenv("OGL_SAMPLES_SHADER_DUMP");
+		return Environment && std::string(Environment) != "0";
+	}
+
+	bool isProgramCacheEnabled()
+	{
+		if(!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary)
+			return false;
+
+		GLint FormatCount(0);
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &FormatCount);
+		if(FormatCount <= 0)
+			return false;
+
+		char const * Environment = getenv("OGL_SAMPLES_PROGRAM_CACHE");
+		return !Environment || std::string(Environment) != "0";
+	}
+
+	std::string getString(GLenum Name)
+	{
+		char const * String = reinterpret_cast<char const *>(glGetString(Name));
+		return String ? String : "";
+	}
+
+	char const PROGRAM_CACHE_MAGIC[4] = {'O', 'G', 'L', 'B'};
+	glm::uint32 const PROGRAM_CACHE_VERSION = 1;
+
+	// Missing, truncated, corrupted or foreign entries are all reported as a miss
+	bool loadProgramCache(std::string const & Filename, glm::uint64 Key, GLenum & Format, std::vector<glm::uint8> & Data)
+	{
+		FILE* File = fopen(Filename.c_str(), "rb");
+		if(!File)
+			return false;
+
+		char Magic[4] = {0, 0, 0, 0};
+		glm::uint32 Version(0);
+		glm::uint64 FileKey(0);
+		glm::uint32 Size(0);
+		glm::uint64 Checksum(0);
+
+		bool Success = true;
+		Success = Success && fread(Magic, sizeof(Magic), 1, File) == 1 && memcmp(Magic, PROGRAM_CACHE_MAGIC, sizeof(Magic)) == 0;
+		Success = Success && fread(&Version, sizeof(Version), 1, File) == 1 && Version == PROGRAM_CACHE_VERSION;
+		Success = Success && fread(&FileKey, sizeof(FileKey), 1, File) == 1 && FileKey == Key;
+		Success = Success && fread(&Format, sizeof(Format), 1, File) == 1;
+		Success = Success && fread(&Size, sizeof(Size), 1, File) == 1 && Size > 0;
+		Success = Success && fread(&Checksum, sizeof(Checksum), 1, File) == 1;
+		if(Success)
+		{
+			Data.resize(Size);
+			Success = fread(&Data[0], Size, 1, File) == 1 && hashData(&Data[0], Data.size()) == Checksum;
+		}
+
+		fclose(File);
+		return Success;
+	}
+
+	// Write to a temporary file then rename it so that a concurrent or interrupted run never sees a partial entry
+	bool saveProgramCache(std::string const & Filename, glm::uint64 Key, GLenum Format, std::vector<glm::uint8> const & Data)
+	{
+		std::string const TempFilename = Filename + ".tmp";
+
+		FILE* File = fopen(TempFilename.c_str(), "wb");
+		if(!File)
+			return false;
+
+		glm::uint32 const Size = static_cast<glm::uint32>(Data.size());
+		glm::uint64 const Checksum = hashData(&Data[0], Data.size());
+
+		bool Success = true;
+		Success = Success && fwrite(PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC), 1, File) == 1;
+		Success = Success && fwrite(&PROGRAM_CACHE_VERSION, sizeof(PROGRAM_CACHE_VERSION), 1, File) == 1;
+		Success = Success && fwrite(&Key, sizeof(Key), 1, File) == 1;
+		Success = Success && fwrite(&Format, sizeof(Format), 1, File) == 1;
+		Success = Success && fwrite(&Size, sizeof(Size), 1, File) == 1;
+		Success = Success && fwrite(&Checksum, sizeof(Checksum), 1, File) == 1;
+		Success = Success && fwrite(&Data[0], Data.size(), 1, File) == 1;
+		Success = fclose(File) == 0 && Success;
+
+		if(Success)
+		{
+#			if defined(_WIN32)
+				std::remove(Filename.c_str());
+#			endif
+			Success = std::rename(TempFilename.c_str(), Filename.c_str()) == 0;
+		}
+
+		if(!Success)
+			std::remove(TempFilename.c_str());
+		return Success;
+	}
+
+	// Only search [Begin, End) so that scanning a source line by line stays linear in its size
+	std::size_t findInLine(std::string const & Source, char const * Pattern, std::size_t Begin, std::size_t End)
+	{
+		std::string::const_iterator const First = Source.begin() + Begin;
+		std::string::const_iterator const Last = Source.begin() + End;
+		std::string::const_iterator const Found = std::search(First, Last, Pattern, Pattern + strlen(Pattern));
+		return Found == Last ? std::string::npos : static_cast<std::size_t>(Found - Source.begin());
+	}
+
+	bool isLineCommentBefore(std::string const & Source, std::size_t Begin, std::size_t Offset)
+	{
+		return findInLine(Source, "//", Begin, Offset) != std::string::npos;
+	}
+
+	std::vector<GLuint> getAttachedShaders(GLuint ProgramName)
+	{
+		GLint ShaderCount(0);
+		glGetProgramiv(ProgramName, GL_ATTACHED_SHADERS, &ShaderCount);
+
+		std::vector<GLuint> ShaderNames(static_cast<std::size_t>(glm::max(ShaderCount, 0)));
+		if(ShaderCount > 0)
+			glGetAttachedShaders(ProgramName, ShaderCount, NULL, &ShaderNames[0]);
+		return ShaderNames;
+	}
+
+	std::string getProgramCacheFilename(glm::uint64 Key)
+	{
+		return getBinaryDirectory() + format("program-%016llx.bin", static_cast<unsigned long long>(Key));
+	}
+}//namespace
 
 compiler::commandline::commandline(std::string const & Filename, std::string const & Arguments) :
 	Profile("core"),
@@ -44,14 +245,14 @@ void compiler::commandline::parseArguments(std::string const & Arguments)
 		std::size_t FoundInclude = Param.find("-I");
 
 		if(FoundDefine != std::string::npos)
-			this->Defines.push_back(Param.substr(2, Param.size() - 2));
+			this->addDefine(Param.substr(2, Param.size() - 2));
 		else if(FoundInclude != std::string::npos)
 			this->Includes.push_back(getDataDirectory() + Param.substr(2, Param.size() - 2));
 		else if(Param == "--define")
 		{
 			std::string Define;
 			Stream >> Define;
-			this->Defines.push_back(Define);
+			this->addDefine(Define);
 		}
 		else if((Param == "--version") || (Param == "-v"))
 			Stream >> Version;
@@ -82,6 +283,25 @@ void compiler::commandline::parseArguments(std::string const & Arguments)
 	}
 }
 
+// -DNAME=VALUE and --define NAME=VALUE give the macro a value
+void compiler::commandline::addDefine(std::string const & Define)
+{
+	std::string Result = Define;
+	std::size_t const Equal = Result.find('=');
+	if(Equal != std::string::npos)
+		Result[Equal] = ' ';
+	this->Defines.push_back(Result);
+}
+
+std::string compiler::commandline::getCacheKey(std::string const & Filename) const
+{
+	std::string Result = format("%s\n%d %s\n", Filename.c_str(), this->Version, this->Profile.c_str());
+	Result += this->getDefines();
+	for(std::size_t i = 0; i < this->Includes.size(); ++i)
+		Result += this->Includes[i] + std::string("\n");
+	return Result;
+}
+
 std::string compiler::commandline::getDefines() const
 {
 	std::string Result;
@@ -94,84 +314,133 @@ std::string compiler::commandline::getDefines() const
 
 std::string compiler::parser::operator()(commandline const & CommandLine, std::string const & Filename) const
 {
-	std::string Source = loadFile(Filename);
-	assert(!Source.empty());
+	std::string const Key = CommandLine.getCacheKey(Filename);
+
+	std::map<std::string, preprocessed>::const_iterator Cached = SourceCache.find(Key);
+	if(Cached != SourceCache.end())
+	{
+		bool Valid = true;
+		for(std::size_t i = 0; Valid && i < Cached->second.Dependencies.size(); ++i)
+		{
+			file const & File = loadCachedFile(Cached->second.Dependencies[i].first);
+			Valid = File.Exists && File.Hash == Cached->second.Dependencies[i].second;
+		}
+
+		if(Valid)
+			return Cached->second.Text;
+	}
+
+	preprocessed Preprocessed;
+	Preprocessed.Text = this->preprocess(CommandLine, Filename, Preprocessed.Dependencies);
+	SourceCache[Key] = Preprocessed;
+
+	return Preprocessed.Text;
+}
+
+std::string compiler::parser::preprocess(commandline const & CommandLine, std::string const & Filename, dependencies & Dependencies) const
+{
+	file const & File = loadCachedFile(Filename);
+	assert(File.Exists && !File.Source.empty());
 
-	std::stringstream Stream;
-	Stream << Source;
-	std::string Line, Text;
+	Dependencies.push_back(std::make_pair(Filename, File.Hash));
+
+	std::string Version, Body;
+	Body.reserve(File.Source.size() * 2);
+	this->scan(CommandLine, File.Source, Version, Body, Dependencies, 0);
 
 	// Handle command line version and profile arguments
+	std::string Header;
 	if(CommandLine.getVersion() != -1)
-		Text += format("#version %d %s\n", CommandLine.getVersion(), CommandLine.getProfile().c_str());
+		Header += format("#version %d %s\n", CommandLine.getVersion(), CommandLine.getProfile().c_str());
 
 	// Handle command line defines
-	Text += CommandLine.getDefines();
+	Header += CommandLine.getDefines();
+
+	// The #version line is always the first of a shader text
+	std::string Text;
+	Text.reserve(Version.size() + Header.size() + Body.size());
+	Text += Version;
+	Text += Header;
+	Text += Body;
+
+	return Text;
+}
+
+void compiler::parser::scan(commandline const & CommandLine, std::string const & Source, std::string & Version, std::string & Text, dependencies & Dependencies, int Depth) const
+{
+	// Guard against recursive includes
+	assert(Depth < 16);
+	if(Depth >= 16)
+		return;
 
-	while(std::getline(Stream, Line))
+	for(std::size_t Begin = 0; Begin < Source.size();)
 	{
-		std::size_t Offset = 0;
+		std::size_t End = Source.find('\n', Begin);
+		std::size_t const Next = End == std::string::npos ? Source.size() : End + 1;
+		if(End == std::string::npos)
+			End = Source.size();
 
 		// Version
-		Offset = Line.find("#version");
-		if(Offset != std::string::npos)
+		std::size_t Offset = findInLine(Source, "#version", Begin, End);
+		if(Offset < End)
 		{
-			std::size_t CommentOffset = Line.find("//");
-			if(CommentOffset != std::string::npos && CommentOffset < Offset)
-				continue;
-
 			// Reorder so that the #version line is always the first of a shader text
-			if(CommandLine.getVersion() == -1)
-				Text = Line + std::string("\n") + Text;
 			// else skip is version is only mentionned
+			if(!isLineCommentBefore(Source, Begin, Offset) && CommandLine.getVersion() == -1 && Version.empty())
+				Version.assign(Source, Begin, End - Begin).append("\n");
+			Begin = Next;
 			continue;
 		}
 
 		// Include
-		Offset = Line.find("#include");
-		if(Offset != std::string::npos)
+		Offset = findInLine(Source, "#include", Begin, End);
+		if(Offset < End)
 		{
-			std::size_t CommentOffset = Line.find("//");
-			if(CommentOffset != std::string::npos && CommentOffset < Offset)
-				continue;
-
-			std::string Include = parseInclude(Line, Offset);
-
-			std::vector<std::string> Includes = CommandLine.getIncludes();
-
-			for(std::size_t i = 0; i < Includes.size(); ++i)
+			if(!isLineCommentBefore(Source, Begin, Offset))
 			{
-				std::string PathName = Includes[i] + Include;
-				std::string IncludeSource = loadFile(PathName);
-				if (!IncludeSource.empty())
+				std::string const Include = parseInclude(Source, Offset, End);
+				std::vector<std::string> const & Includes = CommandLine.getIncludes();
+
+				for(std::size_t i = 0; i < Includes.size(); ++i)
 				{
-					Text += IncludeSource;
-					break;
+					std::string const PathName = Includes[i] + Include;
+					file const & File = loadCachedFile(PathName);
+					if(File.Exists && !File.Source.empty())
+					{
+						Dependencies.push_back(std::make_pair(PathName, File.Hash));
+						this->scan(CommandLine, File.Source, Version, Text, Dependencies, Depth + 1);
+						break;
+					}
 				}
 			}
-
+			Begin = Next;
 			continue;
-		} 
+		}
 
-		Text += Line + "\n";
+		Text.append(Source, Begin, End - Begin).append("\n");
+		Begin = Next;
 	}
-
-	//Text += glf::format("\nconst float G_TRUC_GNI = %f;\n", glm::linearRand(0.0f, 1.0f));
-
-	return Text;
 }
 
-std::string compiler::parser::parseInclude(std::string const & Line, std::size_t const & Offset) const
+std::string compiler::parser::parseInclude(std::string const & Source, std::size_t Offset, std::size_t End) const
 {
-	std::string Result;
-
-	std::string::size_type IncludeFirstQuote = Line.find("\"", Offset);
-	std::string::size_type IncludeSecondQuote = Line.find("\"", IncludeFirstQuote + 1);
-
-	return Line.substr(IncludeFirstQuote + 1, IncludeSecondQuote - IncludeFirstQuote - 1);
+	std::string::size_type IncludeFirstQuote = findInLine(Source, "\"", Offset, End);
+	if(IncludeFirstQuote == std::string::npos)
+		return std::string();
+	std::string::size_type IncludeSecondQuote = findInLine(Source, "\"", IncludeFirstQuote + 1, End);
+	if(IncludeSecondQuote == std::string::npos)
+		return std::string();
+
+	return Source.substr(IncludeFirstQuote + 1, IncludeSecondQuote - IncludeFirstQuote - 1);
 }
 
 // compiler
+compiler::compiler() :
+	SourceDump(isSourceDumpRequested()),
+	ProgramCache(false),
+	ParallelCompile(queryParallelCompile())
+{}
+
 compiler::~compiler()
 {
 	this->clear();
@@ -187,11 +456,22 @@ GLuint compiler::create(GLenum Type, std::string const & Filename, std::string c
 	assert(!PreprocessedSource.empty());
 	char const * PreprocessedSourcePointer = PreprocessedSource.c_str();
 
-	fprintf(stdout, "%s\n", PreprocessedSource.c_str());
+	if(this->SourceDump)
+		fprintf(stdout, "%s\n", PreprocessedSource.c_str());
 
 	GLuint Name = glCreateShader(Type);
 	glShaderSource(Name, 1, &PreprocessedSourcePointer, NULL);
-	glCompileShader(Name);
+
+	// With the program cache, the compilation waits for a link to miss the cache
+	if(this->ProgramCache && isProgramCacheEnabled())
+	{
+		cacheShader Shader;
+		Shader.Hash = hashSource(format("%d\n", Type) + PreprocessedSource);
+		Shader.State = SHADER_DEFERRED;
+		this->CacheShaders[Name] = Shader;
+	}
+	else
+		glCompileShader(Name);
 
 	std::pair<files_map::iterator, bool> ResultFiles = this->ShaderFiles.insert(std::make_pair(Name, Filename));
 	assert(ResultFiles.second);
@@ -203,6 +483,31 @@ GLuint compiler::create(GLenum Type, std::string const & Filename, std::string c
 	return Name;
 }
 
+std::string compiler::preprocess(std::string const & Filename, std::string const & Arguments) const
+{
+	assert(!Filename.empty());
+
+	commandline CommandLine(Filename, Arguments);
+	parser::dependencies Dependencies;
+
+	return parser().preprocess(CommandLine, Filename, Dependencies);
+}
+
+std::vector<GLuint> compiler::create(std::vector<shader> const & Shaders)
+{
+	// Let the driver use as many compiler threads as it wants
+	if(this->ParallelCompile == PARALLEL_COMPILE_KHR)
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+	else if(this->ParallelCompile == PARALLEL_COMPILE_ARB)
+		glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+
+	std::vector<GLuint> Names(Shaders.size(), 0);
+	for(std::size_t i = 0; i < Shaders.size(); ++i)
+		Names[i] = this->create(Shaders[i].Type, Shaders[i].Filename, Shaders[i].Arguments);
+
+	return Names;
+}
+
 bool compiler::destroy(GLuint const & Name)
 {
 	files_map::iterator NameIterator = this->ShaderFiles.find(Name);
@@ -211,6 +516,10 @@ bool compiler::destroy(GLuint const & Name)
 	std::string File = NameIterator->second;
 	this->ShaderFiles.erase(NameIterator);
 
+	// The caller keeps the shader, it can no longer wait for a link
+	this->compileShader(Name);
+	this->CacheShaders.erase(Name);
+
 	// Remove from the pending checks list
 	names_map::iterator PendingIterator = this->PendingChecks.find(File);
 	if(PendingIterator != this->PendingChecks.end())
@@ -224,6 +533,48 @@ bool compiler::destroy(GLuint const & Name)
 	return true;
 }
 
+bool compiler::isCompleted() const
+{
+	if(this->ParallelCompile == PARALLEL_COMPILE_NONE)
+		return true;
+
+	for(names_map::const_iterator ShaderIterator = this->PendingChecks.begin(); ShaderIterator != this->PendingChecks.end(); ++ShaderIterator)
+	{
+		// Deferred shaders are not being compiled
+		shaders_map::const_iterator Shader = this->CacheShaders.find(ShaderIterator->second);
+		if(Shader != this->CacheShaders.end() && Shader->second.State != SHADER_COMPILED)
+			continue;
+
+		GLint Completed = GL_TRUE;
+		glGetShaderiv(ShaderIterator->second, GL_COMPLETION_STATUS_KHR, &Completed);
+		if(Completed == GL_FALSE)
+			return false;
+	}
+
+	return true;
+}
+
+bool compiler::isProgramCompleted(GLuint ProgramName) const
+{
+	if(this->ParallelCompile == PARALLEL_COMPILE_NONE)
+		return true;
+
+	GLint Completed = GL_TRUE;
+	glGetProgramiv(ProgramName, GL_COMPLETION_STATUS_KHR, &Completed);
+	return Completed != GL_FALSE;
+}
+
+// With glewExperimental, GLEW reports the extensions whose entry points resolve, only the context extension strings are reliable
+compiler::parallelCompile compiler::queryParallelCompile()
+{
+	extensionSet const Extensions(GLEW_VERSION_3_0 != GL_FALSE);
+	if(Extensions.isSupported("GL_KHR_parallel_shader_compile"))
+		return PARALLEL_COMPILE_KHR;
+	if(Extensions.isSupported("GL_ARB_parallel_shader_compile"))
+		return PARALLEL_COMPILE_ARB;
+	return PARALLEL_COMPILE_NONE;
+}
+
 bool compiler::validateProgram(GLuint ProgramName) const
 {
 	if(!ProgramName)
@@ -249,6 +600,137 @@ bool compiler::validateProgram(GLuint ProgramName) const
 	return Result == GL_TRUE;
 }
 
+void compiler::compileShader(GLuint ShaderName)
+{
+	shaders_map::iterator Iterator = this->CacheShaders.find(ShaderName);
+	if(Iterator == this->CacheShaders.end() || Iterator->second.State == SHADER_COMPILED)
+		return;
+
+	glCompileShader(ShaderName);
+	Iterator->second.State = SHADER_COMPILED;
+}
+
+// Only programs made of shaders created with the program cache enabled can be identified by their sources
+bool compiler::getProgramCacheKey(GLuint ProgramName, std::string const & Parameters, glm::uint64 & Key, std::vector<GLint> & Formats) const
+{
+	std::vector<GLuint> const ShaderNames = getAttachedShaders(ProgramName);
+
+	std::vector<glm::uint64> SourceHashes;
+	for(std::size_t i = 0; i < ShaderNames.size(); ++i)
+	{
+		shaders_map::const_iterator Iterator = this->CacheShaders.find(ShaderNames[i]);
+		if(Iterator != this->CacheShaders.end())
+			SourceHashes.push_back(Iterator->second.Hash);
+	}
+
+	if(SourceHashes.empty() || SourceHashes.size() != ShaderNames.size() || !isProgramCacheEnabled())
+		return false;
+
+	std::sort(SourceHashes.begin(), SourceHashes.end());
+
+	GLint Separable(GL_FALSE);
+	glGetProgramiv(ProgramName, GL_PROGRAM_SEPARABLE, &Separable);
+
+	GLint FormatCount(0);
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &FormatCount);
+	Formats.resize(static_cast<std::size_t>(FormatCount));
+	glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, &Formats[0]);
+
+	std::string KeyString = getString(GL_VENDOR) + "\n" + getString(GL_RENDERER) + "\n" + getString(GL_VERSION) + "\n";
+	for(std::size_t i = 0; i < Formats.size(); ++i)
+		KeyString += format("%x\n", Formats[i]);
+	for(std::size_t i = 0; i < SourceHashes.size(); ++i)
+		KeyString += format("%016llx\n", static_cast<unsigned long long>(SourceHashes[i]));
+	KeyString += format("%d\n", Separable);
+	KeyString += Parameters;
+
+	Key = hashSource(KeyString);
+	return true;
+}
+
+bool compiler::link(GLuint ProgramName, std::string const & Parameters)
+{
+	assert(ProgramName);
+
+	std::vector<GLuint> const ShaderNames = getAttachedShaders(ProgramName);
+
+	glm::uint64 Key(0);
+	std::vector<GLint> Formats;
+	if(!this->ProgramCache || !this->getProgramCacheKey(ProgramName, Parameters, Key, Formats))
+	{
+		for(std::size_t i = 0; i < ShaderNames.size(); ++i)
+			this->compileShader(ShaderNames[i]);
+		glLinkProgram(ProgramName);
+		return false;
+	}
+
+	std::string const Filename = getProgramCacheFilename(Key);
+
+	GLint Separable(GL_FALSE);
+	glGetProgramiv(ProgramName, GL_PROGRAM_SEPARABLE, &Separable);
+
+	GLenum Format(0);
+	std::vector<glm::uint8> Data;
+	bool const Loaded = loadProgramCache(Filename, Key, Format, Data) && std::find(Formats.begin(), Formats.end(), static_cast<GLint>(Format)) != Formats.end();
+	if(Loaded)
+	{
+		glProgramBinary(ProgramName, Format, &Data[0], static_cast<GLsizei>(Data.size()));
+
+		// Some drivers don't restore GL_PROGRAM_SEPARABLE from the binary
+		GLint Result(GL_FALSE);
+		GLint LoadedSeparable(GL_FALSE);
+		glGetProgramiv(ProgramName, GL_LINK_STATUS, &Result);
+		glGetProgramiv(ProgramName, GL_PROGRAM_SEPARABLE, &LoadedSeparable);
+		if(Result == GL_TRUE && LoadedSeparable == Separable)
+		{
+			for(std::size_t i = 0; i < ShaderNames.size(); ++i)
+			{
+				cacheShader & Shader = this->CacheShaders[ShaderNames[i]];
+				if(Shader.State == SHADER_DEFERRED)
+					Shader.State = SHADER_CACHED;
+			}
+			return true;
+		}
+
+		// Rejected by the driver, typically after a driver update: link from the sources and replace the entry
+	}
+
+	for(std::size_t i = 0; i < ShaderNames.size(); ++i)
+		this->compileShader(ShaderNames[i]);
+
+	glProgramParameteri(ProgramName, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	// The binary we tried replaced the parameters of the program
+	if(Loaded)
+		glProgramParameteri(ProgramName, GL_PROGRAM_SEPARABLE, Separable);
+	glLinkProgram(ProgramName);
+
+	GLint Result(GL_FALSE);
+	glGetProgramiv(ProgramName, GL_LINK_STATUS, &Result);
+	if(Result != GL_TRUE)
+		return false;
+
+	GLint Size(0);
+	glGetProgramiv(ProgramName, GL_PROGRAM_BINARY_LENGTH, &Size);
+	if(Size <= 0)
+		return false;
+
+	Data.resize(static_cast<std::size_t>(Size));
+	glGetProgramBinary(ProgramName, Size, NULL, &Format, &Data[0]);
+	saveProgramCache(Filename, Key, Format, Data);
+
+	return false;
+}
+
+bool compiler::evictProgramCache(GLuint ProgramName, std::string const & Parameters)
+{
+	glm::uint64 Key(0);
+	std::vector<GLint> Formats;
+	if(!this->getProgramCacheKey(ProgramName, Parameters, Key, Formats))
+		return false;
+
+	return std::remove(getProgramCacheFilename(Key).c_str()) == 0;
+}
+
 bool compiler::checkProgram(GLuint ProgramName) const
 {
 	if(!ProgramName)
@@ -286,6 +768,17 @@ bool compiler::check()
 	)
 	{
 		GLuint ShaderName = ShaderIterator->second;
+
+		// Programs loaded from the cache don't need their shaders, the others are compiled now to report their errors.
+		// A deferred shader already deleted by the caller was never attached to a linked program, nothing to report.
+		shaders_map::const_iterator Shader = this->CacheShaders.find(ShaderName);
+		if(Shader != this->CacheShaders.end() && Shader->second.State != SHADER_COMPILED)
+		{
+			if(Shader->second.State == SHADER_CACHED || !glIsShader(ShaderName))
+				continue;
+			this->compileShader(ShaderName);
+		}
+
 		GLint Result = GL_FALSE;
 		glGetShaderiv(ShaderName, GL_COMPILE_STATUS, &Result);
 
@@ -318,6 +811,7 @@ void compiler::clear()
 	this->ShaderNames.clear();
 	this->ShaderFiles.clear();
 	this->PendingChecks.clear();
+	this->CacheShaders.clear();
 }
 
 std::string loadFile(std::string const & Filename)
@@ -54,9 +54,13 @@ class compiler
 		int getVersion() const {return this->Version;}
 		std::string getProfile() const {return this->Profile;}
 		std::string getDefines() const;
-		std::vector<std::string> getIncludes() const {return this->Includes;}
+		std::vector<std::string> const & getIncludes() const {return this->Includes;}
+		// Identify the preprocessed source of Filename with these arguments
+		std::string getCacheKey(std::string const & Filename) const;
 
 	private:
+		void addDefine(std::string const & Define);
+
 		std::string Profile;
 		int Version;
 		std::vector<std::string> Defines;
@@ -66,18 +70,60 @@ class compiler
 	class parser
 	{
 	public:
+		typedef std::vector<std::pair<std::string, glm::uint64> > dependencies;
+
+		// Preprocessed sources are cached per process and revalidated against the content hash of the file and its includes
 		std::string operator() (commandline const & CommandLine, std::string const & Filename) const;
+		// Preprocess without the cache, Dependencies receives the file and its includes with their content hashes
+		std::string preprocess(commandline const & CommandLine, std::string const & Filename, dependencies & Dependencies) const;
 
 	private:
-		std::string parseInclude(std::string const & Line, std::size_t const & Offset) const;
+		void scan(commandline const & CommandLine, std::string const & Source, std::string & Version, std::string & Text, dependencies & Dependencies, int Depth) const;
+		std::string parseInclude(std::string const & Source, std::size_t Offset, std::size_t End) const;
 	};
 
 public:
+	struct shader
+	{
+		shader(GLenum Type, std::string const & Filename, std::string const & Arguments = std::string()) :
+			Type(Type),
+			Filename(Filename),
+			Arguments(Arguments)
+		{}
+
+		GLenum Type;
+		std::string Filename;
+		std::string Arguments;
+	};
+
+	compiler();
 	~compiler();
 
 	GLuint create(GLenum Type, std::string const & Filename, std::string const & Arguments = std::string());
+	// Submit all the shaders before any status query so that the driver can compile them concurrently
+	std::vector<GLuint> create(std::vector<shader> const & Shaders);
 	bool destroy(GLuint const & Name);
 
+	// Preprocessed source of Filename, bypassing the source cache so that every call runs the parser
+	std::string preprocess(std::string const & Filename, std::string const & Arguments = std::string()) const;
+
+	// Print the preprocessed sources on creation, default enabled by OGL_SAMPLES_SHADER_DUMP=1
+	void setSourceDump(bool Enable){this->SourceDump = Enable;}
+
+	// Non-blocking with KHR_parallel_shader_compile or ARB_parallel_shader_compile, always true otherwise
+	bool isCompleted() const;
+	bool isProgramCompleted(GLuint ProgramName) const;
+
+	// Opt-in, programs linked by link() go through a program binary cache stored in the binary directory. The shaders
+	// created meanwhile are only compiled when a link misses the cache or by check(). OGL_SAMPLES_PROGRAM_CACHE=0 disables it
+	void setProgramCache(bool Enable){this->ProgramCache = Enable;}
+	// Same as glLinkProgram, returns true when the program was loaded from the cache. Parameters identifies the state set
+	// before the link that changes the program without changing its sources: attribute and fragment data locations,
+	// transform feedback varyings
+	bool link(GLuint ProgramName, std::string const & Parameters = std::string());
+	// Remove the cache entry of a program so that its next link misses the cache
+	bool evictProgramCache(GLuint ProgramName, std::string const & Parameters = std::string());
+
 	bool checkProgram(GLuint ProgramName) const;
 	bool validateProgram(GLuint ProgramName) const;
 
@@ -87,9 +133,45 @@ public:
 	void clear();
 
 private:
+	enum shaderState
+	{
+		// Waiting for a link to miss the program cache before being compiled
+		SHADER_DEFERRED,
+		// Only attached to programs loaded from the program cache, never compiled
+		SHADER_CACHED,
+		SHADER_COMPILED
+	};
+
+	struct cacheShader
+	{
+		glm::uint64 Hash;
+		shaderState State;
+	};
+
+	typedef std::map<GLuint, cacheShader> shaders_map;
+
+	enum parallelCompile
+	{
+		PARALLEL_COMPILE_NONE,
+		PARALLEL_COMPILE_KHR,
+		PARALLEL_COMPILE_ARB
+	};
+
+	static parallelCompile queryParallelCompile();
+
+	// Key: preprocessed stage sources, link parameters, driver identity and supported binary formats
+	bool getProgramCacheKey(GLuint ProgramName, std::string const & Parameters, glm::uint64 & Key, std::vector<GLint> & Formats) const;
+	// Compile a deferred shader, the first time it is needed
+	void compileShader(GLuint ShaderName);
+
 	names_map ShaderNames;
 	files_map ShaderFiles;
 	names_map PendingChecks;
+	bool SourceDump;
+	bool ProgramCache;
+	parallelCompile ParallelCompile;
+	// Shaders created with the program cache enabled
+	shaders_map CacheShaders;
 };
 
 std::string loadFile(std::string const & Filename);
@@ -24,6 +24,8 @@
 #include "csv.hpp"
 #include <cstdio>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 
 std::string format(const char * Message, ...)
 {
@@ -34,29 +36,143 @@ std::string format(const char * Message, ...)
 
 	va_list ap;
 	va_start(ap, Message);
-		std::vsprintf(Text, Message, ap);
+		std::vsnprintf(Text, sizeof(Text), Message, ap);
 	va_end(ap);
 
 	return Text;
 }
 
-void csv::log(char const * String, double Convergent, double Min, double Max)
+namespace
 {
-	this->Data.push_back(data(String, Convergent, Min, Max));
+	// Nearest rank percentile of sorted samples
+	double percentile(std::vector<double> const & Sorted, double Percent)
+	{
+		assert(!Sorted.empty());
+
+		std::size_t const Rank = static_cast<std::size_t>(std::ceil(Percent / 100.0 * static_cast<double>(Sorted.size())));
+		return Sorted[Rank > 0 ? Rank - 1 : 0];
+	}
+
+	// Escape a string for a JSON value, control characters included
+	std::string escape(std::string const & String)
+	{
+		std::string Result;
+		Result.reserve(String.size());
+		for(std::size_t i = 0; i < String.size(); ++i)
+		{
+			unsigned char const Char = static_cast<unsigned char>(String[i]);
+			if(Char == '"' || Char == '\\')
+				Result += std::string("\\") + String[i];
+			else if(Char == '\n')
+				Result += "\\n";
+			else if(Char == '\r')
+				Result += "\\r";
+			else if(Char == '\t')
+				Result += "\\t";
+			else if(Char < 0x20)
+				Result += ::format("\\u%04x", Char);
+			else
+				Result += String[i];
+		}
+		return Result;
+	}
+
+	bool isEmptyFile(char const * Filename)
+	{
+		FILE* File(fopen(Filename, "rb"));
+		if(!File)
+			return true;
+		fseek(File, 0, SEEK_END);
+		bool const Empty = ftell(File) <= 0;
+		fclose(File);
+		return Empty;
+	}
+}//namespace
+
+csv::csv(std::size_t WarmupCount) :
+	WarmupCount(WarmupCount)
+{}
+
+void csv::log(char const * String, double Average, double Min, double Max)
+{
+	data Data(String);
+	Data.Count = 1;
+	Data.Average = Data.Median = Data.Percentile95 = Data.Percentile99 = Average;
+	Data.Min = Min;
+	Data.Max = Max;
+	this->Data.push_back(Data);
 }
 
-void csv::save(char const * Filename)
+void csv::log(char const * String, std::vector<double> const & Samples, std::string const & Renderer, std::string const & Version, bool Time)
 {
-	FILE* File(fopen(Filename, "a+"));
+	data Data(String);
+	Data.Time = Time;
+	Data.Renderer = Renderer;
+	Data.Version = Version;
+
+	if(Samples.size() > this->WarmupCount)
+		Data.Samples.assign(Samples.begin() + this->WarmupCount, Samples.end());
+
+	Data.Count = Data.Samples.size();
+	if(Data.Count > 0)
+	{
+		std::vector<double> Sorted(Data.Samples);
+		std::sort(Sorted.begin(), Sorted.end());
+
+		double Sum(0.0);
+		for(std::size_t i = 0; i < Sorted.size(); ++i)
+			Sum += Sorted[i];
+		Data.Average = Sum / static_cast<double>(Data.Count);
+
+		double Variance(0.0);
+		for(std::size_t i = 0; i < Sorted.size(); ++i)
+			Variance += (Sorted[i] - Data.Average) * (Sorted[i] - Data.Average);
+		Data.Deviation = std::sqrt(Variance / static_cast<double>(Data.Count));
+
+		Data.Min = Sorted.front();
+		Data.Max = Sorted.back();
+		Data.Median = percentile(Sorted, 50.0);
+		Data.Percentile95 = percentile(Sorted, 95.0);
+		Data.Percentile99 = percentile(Sorted, 99.0);
+	}
+
+	this->Data.push_back(Data);
+}
+
+void csv::save(char const * Filename, format Format)
+{
+	bool const WriteHeader = Format == FORMAT_CSV && isEmptyFile(Filename);
+
+	FILE* File(fopen(Filename, "a"));
 	assert(File);
-	fprintf(File, "%s;%s;%s;%s\n", "Tests", "average", "max", "min");
+	if(!File)
+		return;
 
+	if(WriteHeader)
+		fprintf(File, "%s;%s;%s;%s;%s;%s;%s;%s;%s;%s;%s\n",
+			"Tests", "renderer", "version", "count", "average", "min", "max", "median", "p95", "p99", "deviation");
+
+	// %.17g round trips the doubles, %.6f dropped the digits of small times and large rates
 	for(std::size_t i = 0; i < this->Data.size(); ++i)
 	{
-		fprintf(File, "%s;%d;%d;%d\n",
-			Data[i].String.c_str(),
-			static_cast<int>(Data[i].Convergent),
-			static_cast<int>(Data[i].Max), static_cast<int>(Data[i].Min));
+		data const & Data = this->Data[i];
+
+		if(Format == FORMAT_CSV)
+		{
+			fprintf(File, "%s;%s;%s;%d;%.17g;%.17g;%.17g;%.17g;%.17g;%.17g;%.17g\n",
+				Data.String.c_str(), Data.Renderer.c_str(), Data.Version.c_str(), static_cast<int>(Data.Count),
+				Data.Average, Data.Min, Data.Max, Data.Median, Data.Percentile95, Data.Percentile99, Data.Deviation);
+		}
+		else
+		{
+			fprintf(File, "{\"test\":\"%s\",\"renderer\":\"%s\",\"version\":\"%s\",\"count\":%d,"
+				"\"average\":%.17g,\"min\":%.17g,\"max\":%.17g,\"median\":%.17g,\"p95\":%.17g,\"p99\":%.17g,\"deviation\":%.17g,\"samples\":[",
+				escape(Data.String).c_str(), escape(Data.Renderer).c_str(), escape(Data.Version).c_str(), static_cast<int>(Data.Count),
+				Data.Average, Data.Min, Data.Max, Data.Median, Data.Percentile95, Data.Percentile99, Data.Deviation);
+			for(std::size_t j = 0; j < Data.Samples.size(); ++j)
+				fprintf(File, j == 0 ? "%.17g" : ",%.17g", Data.Samples[j]);
+			fprintf(File, "]}\n");
+		}
 	}
 	fclose(File);
 }
@@ -66,10 +182,13 @@ void csv::print()
 	fprintf(stdout, "\n");
 	for(std::size_t i = 0; i < this->Data.size(); ++i)
 	{
-		fprintf(stdout, "%s, %2.5f, %2.5f, %2.5f\n",
+		double const Scale = Data[i].Time ? 1.0 / 1000.0 : 1.0;
+
+		fprintf(stdout, "%s, %2.5f, %2.5f, %2.5f, median %2.5f, p95 %2.5f, p99 %2.5f, deviation %2.5f (%d samples)\n",
 			Data[i].String.c_str(),
-			Data[i].Convergent / 1000.0,
-			Data[i].Min / 1000.0, Data[i].Max / 1000.0);
+			Data[i].Average * Scale,
+			Data[i].Min * Scale, Data[i].Max * Scale,
+			Data[i].Median * Scale, Data[i].Percentile95 * Scale, Data[i].Percentile99 * Scale,
+			Data[i].Deviation * Scale, static_cast<int>(Data[i].Count));
 	}
 }
-
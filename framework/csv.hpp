@@ -34,25 +34,50 @@ class csv
 {
 	struct data
 	{
-		data(
-			std::string const & String,
-			double Convergent, double Min, double Max) :
+		data(std::string const & String) :
 			String(String),
-			Convergent(Convergent), Min(Min), Max(Max)
+			Count(0),
+			Average(0.0), Min(0.0), Max(0.0),
+			Median(0.0), Percentile95(0.0), Percentile99(0.0),
+			Deviation(0.0),
+			Time(true)
 		{}
 
 		std::string String;
-		double Convergent;
+		std::string Renderer;
+		std::string Version;
+		std::size_t Count;
+		double Average;
 		double Min;
 		double Max;
+		double Median;
+		double Percentile95;
+		double Percentile99;
+		double Deviation;
+		bool Time;
+		std::vector<double> Samples;
 	};
 
 public:
+	enum format
+	{
+		FORMAT_CSV,
+		FORMAT_JSON_LINES
+	};
+
+	// WarmupCount: Number of first samples of each log excluded from the statistics
+	explicit csv(std::size_t WarmupCount = 0);
+
 	void log(char const * String, double Average, double Min, double Max);
-	void save(char const * Filename);
+	// Time: Samples are durations in microseconds, printed in milliseconds. Otherwise they are counts or rates printed as is.
+	void log(char const * String, std::vector<double> const & Samples, std::string const & Renderer, std::string const & Version, bool Time = true);
+
+	// FORMAT_CSV appends one row per log with a header only when the file is new.
+	// FORMAT_JSON_LINES appends one JSON object per log including the raw samples.
+	void save(char const * Filename, format Format = FORMAT_CSV);
 	void print();
 
 private:
+	std::size_t const WarmupCount;
 	std::vector<data> Data;
 };
-
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "headless.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#	define OGL_SAMPLES_EGL
+#	include <EGL/egl.h>
+#	include <EGL/eglext.h>
+#endif
+
+#if defined(OGL_SAMPLES_EGL)
+namespace
+{
+	bool hasExtension(char const * Extensions, char const * Name)
+	{
+		if(!Extensions)
+			return false;
+
+		std::size_t const Length = strlen(Name);
+		for(char const * Found = strstr(Extensions, Name); Found; Found = strstr(Found + Length, Name))
+			if((Found == Extensions || Found[-1] == ' ') && (Found[Length] == ' ' || Found[Length] == '\0'))
+				return true;
+		return false;
+	}
+
+	EGLDisplay getDisplay()
+	{
+		// Prefer Mesa surfaceless platform: it doesn't need X11, Wayland or a DRM device
+		char const * ClientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		if(hasExtension(ClientExtensions, "EGL_MESA_platform_surfaceless") && hasExtension(ClientExtensions, "EGL_EXT_platform_base"))
+		{
+			PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+			if(GetPlatformDisplay)
+			{
+				EGLDisplay Display = GetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+				if(Display != EGL_NO_DISPLAY)
+					return Display;
+			}
+		}
+
+		return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+}//namespace
+#endif//OGL_SAMPLES_EGL
+
+bool headless::isRequested(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; ++i)
+		if(argv[i] && strcmp(argv[i], "--headless") == 0)
+			return true;
+
+	char const * Environment = getenv("OGL_SAMPLES_HEADLESS");
+	return Environment && strcmp(Environment, "0") != 0;
+}
+
+headless::headless(glm::uvec2 const & Size, bool ES, int Major, int Minor, bool Core, bool Debug) :
+	Size(Size),
+	Display(nullptr),
+	Surface(nullptr),
+	Context(nullptr)
+{
+#	if defined(OGL_SAMPLES_EGL)
+		EGLDisplay Display = getDisplay();
+		if(Display == EGL_NO_DISPLAY || !eglInitialize(Display, nullptr, nullptr))
+		{
+			fprintf(stderr, "Headless: failed to initialize EGL display\n");
+			return;
+		}
+		this->Display = Display;
+
+		if(!eglBindAPI(ES ? EGL_OPENGL_ES_API : EGL_OPENGL_API))
+		{
+			fprintf(stderr, "Headless: failed to bind %s API\n", ES ? "OpenGL ES" : "OpenGL");
+			return;
+		}
+
+		EGLint const ConfigAttribs[] =
+		{
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, ES ? (Major >= 3 ? EGL_OPENGL_ES3_BIT_KHR : EGL_OPENGL_ES2_BIT) : EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24,
+			EGL_STENCIL_SIZE, 8,
+			EGL_NONE
+		};
+
+		EGLConfig Config = nullptr;
+		EGLint ConfigCount = 0;
+		if(!eglChooseConfig(Display, ConfigAttribs, &Config, 1, &ConfigCount) || ConfigCount == 0)
+		{
+			fprintf(stderr, "Headless: no pbuffer capable EGL config\n");
+			return;
+		}
+
+		EGLint const SurfaceAttribs[] =
+		{
+			EGL_WIDTH, static_cast<EGLint>(Size.x),
+			EGL_HEIGHT, static_cast<EGLint>(Size.y),
+			EGL_NONE
+		};
+
+		EGLSurface Surface = eglCreatePbufferSurface(Display, Config, SurfaceAttribs);
+		if(Surface == EGL_NO_SURFACE)
+		{
+			fprintf(stderr, "Headless: failed to create %dx%d pbuffer\n", Size.x, Size.y);
+			return;
+		}
+		this->Surface = Surface;
+
+		EGLint ContextFlags = Debug ? EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR : 0;
+		if(!ES && Core)
+			ContextFlags |= EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR;
+
+		EGLint ContextAttribs[] =
+		{
+			EGL_CONTEXT_MAJOR_VERSION_KHR, Major,
+			EGL_CONTEXT_MINOR_VERSION_KHR, Minor,
+			EGL_CONTEXT_FLAGS_KHR, ContextFlags,
+			EGL_NONE, EGL_NONE,
+			EGL_NONE
+		};
+
+		// Profiles only exist from OpenGL 3.2
+		if(!ES && Major * 10 + Minor >= 32)
+		{
+			ContextAttribs[6] = EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR;
+			ContextAttribs[7] = Core ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR;
+		}
+
+		EGLContext Context = eglCreateContext(Display, Config, EGL_NO_CONTEXT, ContextAttribs);
+		if(Context == EGL_NO_CONTEXT)
+		{
+			fprintf(stderr, "Headless: failed to create OpenGL%s %d.%d context\n", ES ? " ES" : "", Major, Minor);
+			return;
+		}
+		this->Context = Context;
+
+		if(!eglMakeCurrent(Display, Surface, Surface, Context))
+		{
+			fprintf(stderr, "Headless: failed to make the context current\n");
+			eglDestroyContext(Display, Context);
+			this->Context = nullptr;
+		}
+#	else
+		fprintf(stderr, "Headless: not supported on this platform\n");
+#	endif//OGL_SAMPLES_EGL
+}
+
+headless::~headless()
+{
+#	if defined(OGL_SAMPLES_EGL)
+		if(!this->Display)
+			return;
+
+		eglMakeCurrent(this->Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if(this->Context)
+			eglDestroyContext(this->Display, this->Context);
+		if(this->Surface)
+			eglDestroySurface(this->Display, this->Surface);
+		eglTerminate(this->Display);
+#	endif//OGL_SAMPLES_EGL
+}
+
+bool headless::isValid() const
+{
+	return this->Context != nullptr;
+}
+
+void headless::swap()
+{
+#	if defined(OGL_SAMPLES_EGL)
+		eglSwapBuffers(this->Display, this->Surface);
+#	endif//OGL_SAMPLES_EGL
+}
+
+void headless::sync(int Interval)
+{
+#	if defined(OGL_SAMPLES_EGL)
+		eglSwapInterval(this->Display, Interval);
+#	endif//OGL_SAMPLES_EGL
+}
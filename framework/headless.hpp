@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/vec2.hpp>
+
+// Offscreen context used when no display server is available.
+// The context renders into an EGL pbuffer which acts as the default framebuffer,
+// so samples binding framebuffer 0 and checkTemplate reading it back work unchanged.
+class headless
+{
+public:
+	headless(glm::uvec2 const & Size, bool ES, int Major, int Minor, bool Core, bool Debug);
+	~headless();
+
+	bool isValid() const;
+	void swap();
+	void sync(int Interval);
+	glm::uvec2 getSize() const{return this->Size;}
+
+	// Headless mode is selected with "--headless" on the command line or the OGL_SAMPLES_HEADLESS environment variable
+	static bool isRequested(int argc, char* argv[]);
+
+private:
+	headless(headless const &);
+	headless& operator=(headless const &);
+
+	glm::uvec2 const Size;
+	void* Display;
+	void* Surface;
+	void* Context;
+};
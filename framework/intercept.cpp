@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "intercept.hpp"
+#include <GL/glew.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	intercept::counters Counters;
+	bool Installed(false);
+
+	template <typename pointer>
+	void patch(pointer & Pointer, pointer & Real, pointer Hook)
+	{
+		// Missing entry point or already patched by a previous install in the same context
+		if(Pointer == nullptr || Pointer == Hook)
+			return;
+
+		Real = Pointer;
+		Pointer = Hook;
+	}
+
+	template <typename pointer>
+	void restore(pointer & Pointer, pointer Real, pointer Hook)
+	{
+		if(Pointer == Hook)
+			Pointer = Real;
+	}
+
+	void countUpload(GLsizeiptr Size)
+	{
+		++Counters.Uploads;
+		Counters.UploadedBytes += static_cast<std::size_t>(Size);
+	}
+
+#	define INTERCEPT_CALL(Name, Counter, Parameters, Arguments) \
+		decltype(__glew##Name) Real##Name(nullptr); \
+		void GLAPIENTRY hook##Name Parameters \
+		{ \
+			++Counters.Counter; \
+			Real##Name Arguments; \
+		}
+#	include "intercept_calls.inl"
+#	undef INTERCEPT_CALL
+
+	PFNGLBUFFERDATAPROC RealBufferData(nullptr);
+	PFNGLBUFFERSUBDATAPROC RealBufferSubData(nullptr);
+	PFNGLBUFFERSTORAGEPROC RealBufferStorage(nullptr);
+	PFNGLNAMEDBUFFERDATAPROC RealNamedBufferData(nullptr);
+	PFNGLNAMEDBUFFERSUBDATAPROC RealNamedBufferSubData(nullptr);
+	PFNGLNAMEDBUFFERSTORAGEPROC RealNamedBufferStorage(nullptr);
+	PFNGLMAPBUFFERRANGEPROC RealMapBufferRange(nullptr);
+	PFNGLMAPNAMEDBUFFERRANGEPROC RealMapNamedBufferRange(nullptr);
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC RealFlushMappedBufferRange(nullptr);
+	PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC RealFlushMappedNamedBufferRange(nullptr);
+
+	void GLAPIENTRY hookBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		if(data)
+			countUpload(size);
+		RealBufferData(target, size, data, usage);
+	}
+
+	void GLAPIENTRY hookBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		countUpload(size);
+		RealBufferSubData(target, offset, size, data);
+	}
+
+	void GLAPIENTRY hookBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+	{
+		if(data)
+			countUpload(size);
+		RealBufferStorage(target, size, data, flags);
+	}
+
+	void GLAPIENTRY hookNamedBufferData(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		if(data)
+			countUpload(size);
+		RealNamedBufferData(buffer, size, data, usage);
+	}
+
+	void GLAPIENTRY hookNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		countUpload(size);
+		RealNamedBufferSubData(buffer, offset, size, data);
+	}
+
+	void GLAPIENTRY hookNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags)
+	{
+		if(data)
+			countUpload(size);
+		RealNamedBufferStorage(buffer, size, data, flags);
+	}
+
+	// Bytes per texel of client pixel data, 0 for the formats and types the layer doesn't know
+	std::size_t texelSize(GLenum Format, GLenum Type)
+	{
+		std::size_t Components = 0;
+		switch(Format)
+		{
+		case GL_RED: case GL_GREEN: case GL_BLUE: case GL_ALPHA: case GL_LUMINANCE:
+		case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+			Components = 1; break;
+		case GL_RG: case GL_RG_INTEGER: case GL_LUMINANCE_ALPHA: case GL_DEPTH_STENCIL:
+			Components = 2; break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+			Components = 3; break;
+		case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+			Components = 4; break;
+		default:
+			return 0;
+		}
+
+		switch(Type)
+		{
+		case GL_UNSIGNED_BYTE: case GL_BYTE:
+			return Components;
+		case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+			return Components * 2;
+		case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+			return Components * 4;
+		// Packed types store all the components of a texel
+		case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+			return 1;
+		case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+		case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+		case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+			return 2;
+		case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+		case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+		case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+			return 4;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			return 8;
+		default:
+			return 0;
+		}
+	}
+
+	// A write mapping without explicit flush uploads its whole range when unmapped
+	bool isUploadMapping(GLbitfield Access)
+	{
+		return (Access & GL_MAP_WRITE_BIT) && !(Access & (GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_PERSISTENT_BIT));
+	}
+
+	void* GLAPIENTRY hookMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		if(isUploadMapping(access))
+			countUpload(length);
+		return RealMapBufferRange(target, offset, length, access);
+	}
+
+	void* GLAPIENTRY hookMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		if(isUploadMapping(access))
+			countUpload(length);
+		return RealMapNamedBufferRange(buffer, offset, length, access);
+	}
+
+	void GLAPIENTRY hookFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+	{
+		countUpload(length);
+		RealFlushMappedBufferRange(target, offset, length);
+	}
+
+	void GLAPIENTRY hookFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+	{
+		countUpload(length);
+		RealFlushMappedNamedBufferRange(buffer, offset, length);
+	}
+}//namespace
+
+// Wrappers of the OpenGL 1.1 entry points declared by intercept_gl11.hpp, this file sees the real functions
+#define INTERCEPT_CALL(Name, Counter, Parameters, Arguments) \
+	void GLAPIENTRY intercept##Name Parameters \
+	{ \
+		if(Installed) \
+			++Counters.Counter; \
+		gl##Name Arguments; \
+	}
+#include "intercept_gl11_calls.inl"
+#undef INTERCEPT_CALL
+
+// Without pixels glTexImage2D only allocates the storage, an upload from an unpack buffer at offset 0 isn't counted
+void GLAPIENTRY interceptTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	if(Installed && pixels)
+		countUpload(static_cast<GLsizeiptr>(width * height * texelSize(format, type)));
+	glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+void GLAPIENTRY interceptTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	if(Installed)
+		countUpload(static_cast<GLsizeiptr>(width * height * texelSize(format, type)));
+	glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+void intercept::install()
+{
+#	define INTERCEPT_CALL(Name, Counter, Parameters, Arguments) patch(__glew##Name, Real##Name, &hook##Name);
+#	include "intercept_calls.inl"
+#	undef INTERCEPT_CALL
+
+	patch(__glewBufferData, RealBufferData, &hookBufferData);
+	patch(__glewBufferSubData, RealBufferSubData, &hookBufferSubData);
+	patch(__glewBufferStorage, RealBufferStorage, &hookBufferStorage);
+	patch(__glewNamedBufferData, RealNamedBufferData, &hookNamedBufferData);
+	patch(__glewNamedBufferSubData, RealNamedBufferSubData, &hookNamedBufferSubData);
+	patch(__glewNamedBufferStorage, RealNamedBufferStorage, &hookNamedBufferStorage);
+	patch(__glewMapBufferRange, RealMapBufferRange, &hookMapBufferRange);
+	patch(__glewMapNamedBufferRange, RealMapNamedBufferRange, &hookMapNamedBufferRange);
+	patch(__glewFlushMappedBufferRange, RealFlushMappedBufferRange, &hookFlushMappedBufferRange);
+	patch(__glewFlushMappedNamedBufferRange, RealFlushMappedNamedBufferRange, &hookFlushMappedNamedBufferRange);
+
+	Installed = true;
+}
+
+void intercept::uninstall()
+{
+#	define INTERCEPT_CALL(Name, Counter, Parameters, Arguments) restore(__glew##Name, Real##Name, &hook##Name);
+#	include "intercept_calls.inl"
+#	undef INTERCEPT_CALL
+
+	restore(__glewBufferData, RealBufferData, &hookBufferData);
+	restore(__glewBufferSubData, RealBufferSubData, &hookBufferSubData);
+	restore(__glewBufferStorage, RealBufferStorage, &hookBufferStorage);
+	restore(__glewNamedBufferData, RealNamedBufferData, &hookNamedBufferData);
+	restore(__glewNamedBufferSubData, RealNamedBufferSubData, &hookNamedBufferSubData);
+	restore(__glewNamedBufferStorage, RealNamedBufferStorage, &hookNamedBufferStorage);
+	restore(__glewMapBufferRange, RealMapBufferRange, &hookMapBufferRange);
+	restore(__glewMapNamedBufferRange, RealMapNamedBufferRange, &hookMapNamedBufferRange);
+	restore(__glewFlushMappedBufferRange, RealFlushMappedBufferRange, &hookFlushMappedBufferRange);
+	restore(__glewFlushMappedNamedBufferRange, RealFlushMappedNamedBufferRange, &hookFlushMappedNamedBufferRange);
+
+	Installed = false;
+}
+
+bool intercept::isInstalled()
+{
+	return Installed;
+}
+
+intercept::counters const & intercept::get()
+{
+	return Counters;
+}
+
+void intercept::reset()
+{
+	Counters = counters();
+}
+
+bool intercept::isRequested(int argc, char* argv[])
+{
+	for(int i = 1; i < argc; ++i)
+		if(argv[i] && strcmp(argv[i], "--count-calls") == 0)
+			return true;
+
+	char const * Environment = getenv("OGL_SAMPLES_COUNT_CALLS");
+	return Environment && strcmp(Environment, "0") != 0;
+}
@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+
+// Opt-in layer counting the GL calls of a test by patching the function pointers loaded by GLEW.
+// When it is not installed the pointers are untouched and the calls go straight to the driver.
+// The OpenGL 1.1 entry points (glDrawArrays, glBindTexture, glEnable...) are linked directly, they are counted
+// by the wrappers of intercept_gl11.hpp in the code including it when built with OGL_SAMPLES_INTERCEPT_GL11.
+class intercept
+{
+public:
+	struct counters
+	{
+		counters() :
+			Draws(0),
+			Binds(0),
+			Uniforms(0),
+			States(0),
+			Uploads(0),
+			UploadedBytes(0)
+		{}
+
+		std::size_t Draws;
+		std::size_t Binds;
+		std::size_t Uniforms;
+		std::size_t States;
+		// Buffer data uploads, flushed mapped ranges and glTex(Sub)Image2D, writes to coherent persistent mappings are invisible
+		std::size_t Uploads;
+		std::size_t UploadedBytes;
+	};
+
+	// Patch the pointers loaded by the last glewInit, it needs to be called again after each glewInit
+	static void install();
+	static void uninstall();
+	static bool isInstalled();
+
+	// Calls counted since the last reset
+	static counters const & get();
+	static void reset();
+
+	// Interception is requested with "--count-calls" on the command line or the OGL_SAMPLES_COUNT_CALLS environment variable
+	static bool isRequested(int argc, char* argv[]);
+};
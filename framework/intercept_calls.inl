@@ -0,0 +1,170 @@
+// Entry points counted by the interception layer: INTERCEPT_CALL(Name, Counter, Parameters, Arguments)
+// Only functions GLEW loads through a pointer can be patched, the OpenGL 1.1 ones are listed in intercept_gl11_calls.inl
+
+// Draw calls
+INTERCEPT_CALL(DrawArraysInstanced, Draws, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount))
+INTERCEPT_CALL(DrawArraysInstancedBaseInstance, Draws, (GLenum mode, GLint first, GLsizei count, GLsizei primcount, GLuint baseinstance), (mode, first, count, primcount, baseinstance))
+INTERCEPT_CALL(DrawArraysIndirect, Draws, (GLenum mode, const void *indirect), (mode, indirect))
+INTERCEPT_CALL(MultiDrawArrays, Draws, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+INTERCEPT_CALL(MultiDrawArraysIndirect, Draws, (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride), (mode, indirect, primcount, stride))
+INTERCEPT_CALL(DrawElementsInstanced, Draws, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount), (mode, count, type, indices, primcount))
+INTERCEPT_CALL(DrawElementsBaseVertex, Draws, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+INTERCEPT_CALL(DrawElementsInstancedBaseVertex, Draws, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLint basevertex), (mode, count, type, indices, primcount, basevertex))
+INTERCEPT_CALL(DrawElementsInstancedBaseInstance, Draws, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLuint baseinstance), (mode, count, type, indices, primcount, baseinstance))
+INTERCEPT_CALL(DrawElementsInstancedBaseVertexBaseInstance, Draws, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, primcount, basevertex, baseinstance))
+INTERCEPT_CALL(DrawElementsIndirect, Draws, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+INTERCEPT_CALL(MultiDrawElements, Draws, (GLenum mode, const GLsizei *count, GLenum type, const void *const* indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+INTERCEPT_CALL(MultiDrawElementsBaseVertex, Draws, (GLenum mode, const GLsizei* count, GLenum type, const void *const *indices, GLsizei primcount, const GLint *basevertex), (mode, count, type, indices, primcount, basevertex))
+INTERCEPT_CALL(MultiDrawElementsIndirect, Draws, (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride), (mode, type, indirect, primcount, stride))
+INTERCEPT_CALL(DrawRangeElements, Draws, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+INTERCEPT_CALL(DrawRangeElementsBaseVertex, Draws, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+INTERCEPT_CALL(DrawTransformFeedback, Draws, (GLenum mode, GLuint id), (mode, id))
+INTERCEPT_CALL(DrawTransformFeedbackInstanced, Draws, (GLenum mode, GLuint id, GLsizei primcount), (mode, id, primcount))
+INTERCEPT_CALL(DrawTransformFeedbackStream, Draws, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+INTERCEPT_CALL(DrawTransformFeedbackStreamInstanced, Draws, (GLenum mode, GLuint id, GLuint stream, GLsizei primcount), (mode, id, stream, primcount))
+INTERCEPT_CALL(MultiDrawArraysIndirectCountARB, Draws, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+INTERCEPT_CALL(MultiDrawElementsIndirectCountARB, Draws, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+
+// Object bindings
+INTERCEPT_CALL(ActiveTexture, Binds, (GLenum texture), (texture))
+INTERCEPT_CALL(BindBuffer, Binds, (GLenum target, GLuint buffer), (target, buffer))
+INTERCEPT_CALL(BindBufferBase, Binds, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+INTERCEPT_CALL(BindBufferRange, Binds, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+INTERCEPT_CALL(BindBuffersBase, Binds, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers), (target, first, count, buffers))
+INTERCEPT_CALL(BindBuffersRange, Binds, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+INTERCEPT_CALL(BindVertexArray, Binds, (GLuint array), (array))
+INTERCEPT_CALL(BindVertexBuffer, Binds, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+INTERCEPT_CALL(BindVertexBuffers, Binds, (GLuint first, GLsizei count, const GLuint* buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+INTERCEPT_CALL(VertexArrayVertexBuffer, Binds, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+INTERCEPT_CALL(VertexArrayElementBuffer, Binds, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+INTERCEPT_CALL(BindTextures, Binds, (GLuint first, GLsizei count, const GLuint* textures), (first, count, textures))
+INTERCEPT_CALL(BindTextureUnit, Binds, (GLuint unit, GLuint texture), (unit, texture))
+INTERCEPT_CALL(BindSampler, Binds, (GLuint unit, GLuint sampler), (unit, sampler))
+INTERCEPT_CALL(BindSamplers, Binds, (GLuint first, GLsizei count, const GLuint* samplers), (first, count, samplers))
+INTERCEPT_CALL(BindImageTexture, Binds, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+INTERCEPT_CALL(BindImageTextures, Binds, (GLuint first, GLsizei count, const GLuint* textures), (first, count, textures))
+INTERCEPT_CALL(BindFramebuffer, Binds, (GLenum target, GLuint framebuffer), (target, framebuffer))
+INTERCEPT_CALL(BindRenderbuffer, Binds, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+INTERCEPT_CALL(BindProgramPipeline, Binds, (GLuint pipeline), (pipeline))
+INTERCEPT_CALL(UseProgram, Binds, (GLuint program), (program))
+INTERCEPT_CALL(UseProgramStages, Binds, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+INTERCEPT_CALL(BindTransformFeedback, Binds, (GLenum target, GLuint id), (target, id))
+
+// Uniform updates
+INTERCEPT_CALL(Uniform1i, Uniforms, (GLint location, GLint v0), (location, v0))
+INTERCEPT_CALL(Uniform1ui, Uniforms, (GLint location, GLuint v0), (location, v0))
+INTERCEPT_CALL(Uniform1f, Uniforms, (GLint location, GLfloat v0), (location, v0))
+INTERCEPT_CALL(Uniform1d, Uniforms, (GLint location, GLdouble v0), (location, v0))
+INTERCEPT_CALL(Uniform2i, Uniforms, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+INTERCEPT_CALL(Uniform2ui, Uniforms, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+INTERCEPT_CALL(Uniform2f, Uniforms, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+INTERCEPT_CALL(Uniform2d, Uniforms, (GLint location, GLdouble v0, GLdouble v1), (location, v0, v1))
+INTERCEPT_CALL(Uniform3i, Uniforms, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+INTERCEPT_CALL(Uniform3ui, Uniforms, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+INTERCEPT_CALL(Uniform3f, Uniforms, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+INTERCEPT_CALL(Uniform3d, Uniforms, (GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (location, v0, v1, v2))
+INTERCEPT_CALL(Uniform4i, Uniforms, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+INTERCEPT_CALL(Uniform4ui, Uniforms, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+INTERCEPT_CALL(Uniform4f, Uniforms, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+INTERCEPT_CALL(Uniform4d, Uniforms, (GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (location, v0, v1, v2, v3))
+INTERCEPT_CALL(Uniform1iv, Uniforms, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+INTERCEPT_CALL(Uniform1uiv, Uniforms, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+INTERCEPT_CALL(Uniform1fv, Uniforms, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+INTERCEPT_CALL(Uniform1dv, Uniforms, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+INTERCEPT_CALL(Uniform2iv, Uniforms, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+INTERCEPT_CALL(Uniform2uiv, Uniforms, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+INTERCEPT_CALL(Uniform2fv, Uniforms, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+INTERCEPT_CALL(Uniform2dv, Uniforms, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+INTERCEPT_CALL(Uniform3iv, Uniforms, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+INTERCEPT_CALL(Uniform3uiv, Uniforms, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+INTERCEPT_CALL(Uniform3fv, Uniforms, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+INTERCEPT_CALL(Uniform3dv, Uniforms, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+INTERCEPT_CALL(Uniform4iv, Uniforms, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+INTERCEPT_CALL(Uniform4uiv, Uniforms, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+INTERCEPT_CALL(Uniform4fv, Uniforms, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+INTERCEPT_CALL(Uniform4dv, Uniforms, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+INTERCEPT_CALL(UniformMatrix2fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix2dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix2x3fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix2x3dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3x2fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3x2dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix2x4fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix2x4dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4x2fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4x2dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3x4fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix3x4dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4x3fv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformMatrix4x3dv, Uniforms, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+INTERCEPT_CALL(UniformSubroutinesuiv, Uniforms, (GLenum shadertype, GLsizei count, const GLuint* indices), (shadertype, count, indices))
+INTERCEPT_CALL(UniformHandleui64ARB, Uniforms, (GLint location, GLuint64 value), (location, value))
+INTERCEPT_CALL(UniformHandleui64vARB, Uniforms, (GLint location, GLsizei count, const GLuint64* values), (location, count, values))
+INTERCEPT_CALL(ProgramUniform1i, Uniforms, (GLuint program, GLint location, GLint x), (program, location, x))
+INTERCEPT_CALL(ProgramUniform1ui, Uniforms, (GLuint program, GLint location, GLuint x), (program, location, x))
+INTERCEPT_CALL(ProgramUniform1f, Uniforms, (GLuint program, GLint location, GLfloat x), (program, location, x))
+INTERCEPT_CALL(ProgramUniform1d, Uniforms, (GLuint program, GLint location, GLdouble x), (program, location, x))
+INTERCEPT_CALL(ProgramUniform2i, Uniforms, (GLuint program, GLint location, GLint x, GLint y), (program, location, x, y))
+INTERCEPT_CALL(ProgramUniform2ui, Uniforms, (GLuint program, GLint location, GLuint x, GLuint y), (program, location, x, y))
+INTERCEPT_CALL(ProgramUniform2f, Uniforms, (GLuint program, GLint location, GLfloat x, GLfloat y), (program, location, x, y))
+INTERCEPT_CALL(ProgramUniform2d, Uniforms, (GLuint program, GLint location, GLdouble x, GLdouble y), (program, location, x, y))
+INTERCEPT_CALL(ProgramUniform3i, Uniforms, (GLuint program, GLint location, GLint x, GLint y, GLint z), (program, location, x, y, z))
+INTERCEPT_CALL(ProgramUniform3ui, Uniforms, (GLuint program, GLint location, GLuint x, GLuint y, GLuint z), (program, location, x, y, z))
+INTERCEPT_CALL(ProgramUniform3f, Uniforms, (GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z), (program, location, x, y, z))
+INTERCEPT_CALL(ProgramUniform3d, Uniforms, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z), (program, location, x, y, z))
+INTERCEPT_CALL(ProgramUniform4i, Uniforms, (GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w), (program, location, x, y, z, w))
+INTERCEPT_CALL(ProgramUniform4ui, Uniforms, (GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w), (program, location, x, y, z, w))
+INTERCEPT_CALL(ProgramUniform4f, Uniforms, (GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (program, location, x, y, z, w))
+INTERCEPT_CALL(ProgramUniform4d, Uniforms, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, location, x, y, z, w))
+INTERCEPT_CALL(ProgramUniform1iv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform1uiv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform1fv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform1dv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform2iv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform2uiv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform2fv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform2dv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform3iv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform3uiv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform3fv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform3dv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform4iv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform4uiv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform4fv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniform4dv, Uniforms, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+INTERCEPT_CALL(ProgramUniformMatrix2fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix2dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix2x3fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix2x3dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3x2fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3x2dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix2x4fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix2x4dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4x2fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4x2dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3x4fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix3x4dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4x3fv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformMatrix4x3dv, Uniforms, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+INTERCEPT_CALL(ProgramUniformHandleui64ARB, Uniforms, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+INTERCEPT_CALL(ProgramUniformHandleui64vARB, Uniforms, (GLuint program, GLint location, GLsizei count, const GLuint64* values), (program, location, count, values))
+
+// Other state changes
+INTERCEPT_CALL(Enablei, States, (GLenum cap, GLuint index), (cap, index))
+INTERCEPT_CALL(Disablei, States, (GLenum cap, GLuint index), (cap, index))
+INTERCEPT_CALL(BlendFuncSeparatei, States, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+INTERCEPT_CALL(BlendEquation, States, (GLenum mode), (mode))
+INTERCEPT_CALL(BlendEquationSeparatei, States, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+INTERCEPT_CALL(ViewportIndexedf, States, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+INTERCEPT_CALL(ViewportIndexedfv, States, (GLuint index, const GLfloat * v), (index, v))
+INTERCEPT_CALL(ViewportArrayv, States, (GLuint first, GLsizei count, const GLfloat * v), (first, count, v))
+INTERCEPT_CALL(PatchParameteri, States, (GLenum pname, GLint value), (pname, value))
+INTERCEPT_CALL(VertexAttribI1i, States, (GLuint index, GLint v0), (index, v0))
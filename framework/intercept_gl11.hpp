@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GL/glew.h>
+
+// GLEW links the OpenGL 1.1 entry points directly so the interception layer can't patch them.
+// Included after the GL headers, this header redirects them to wrappers counting the calls while the layer is installed.
+// Only the micro benchmarks and the framework sources they rely on include it, and only when built with
+// OGL_SAMPLES_INTERCEPT_GL11 so that the samples keep calling OpenGL directly.
+
+#if defined(OGL_SAMPLES_INTERCEPT_GL11)
+
+#define INTERCEPT_CALL(Name, Counter, Parameters, Arguments) void GLAPIENTRY intercept##Name Parameters;
+#include "intercept_gl11_calls.inl"
+#undef INTERCEPT_CALL
+
+void GLAPIENTRY interceptTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels);
+void GLAPIENTRY interceptTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels);
+
+#define glDrawArrays interceptDrawArrays
+#define glDrawElements interceptDrawElements
+#define glBindTexture interceptBindTexture
+#define glEnable interceptEnable
+#define glDisable interceptDisable
+#define glBlendFunc interceptBlendFunc
+#define glDepthFunc interceptDepthFunc
+#define glDepthMask interceptDepthMask
+#define glColorMask interceptColorMask
+#define glCullFace interceptCullFace
+#define glFrontFace interceptFrontFace
+#define glPolygonMode interceptPolygonMode
+#define glPolygonOffset interceptPolygonOffset
+#define glLineWidth interceptLineWidth
+#define glPointSize interceptPointSize
+#define glScissor interceptScissor
+#define glViewport interceptViewport
+#define glStencilFunc interceptStencilFunc
+#define glStencilOp interceptStencilOp
+#define glStencilMask interceptStencilMask
+#define glPixelStorei interceptPixelStorei
+#define glTexParameteri interceptTexParameteri
+#define glTexParameterf interceptTexParameterf
+#define glTexImage2D interceptTexImage2D
+#define glTexSubImage2D interceptTexSubImage2D
+
+#endif//OGL_SAMPLES_INTERCEPT_GL11
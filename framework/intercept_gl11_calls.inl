@@ -0,0 +1,32 @@
+// OpenGL 1.1 entry points counted by the interception layer: INTERCEPT_CALL(Name, Counter, Parameters, Arguments)
+// GLEW links them directly, intercept_gl11.hpp redirects the calls to counting wrappers instead of patching pointers.
+// The texture uploads count their bytes and are defined separately.
+
+// Draw calls
+INTERCEPT_CALL(DrawArrays, Draws, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+INTERCEPT_CALL(DrawElements, Draws, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices))
+
+// Object bindings
+INTERCEPT_CALL(BindTexture, Binds, (GLenum target, GLuint texture), (target, texture))
+
+// Other state changes
+INTERCEPT_CALL(Enable, States, (GLenum cap), (cap))
+INTERCEPT_CALL(Disable, States, (GLenum cap), (cap))
+INTERCEPT_CALL(BlendFunc, States, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+INTERCEPT_CALL(DepthFunc, States, (GLenum func), (func))
+INTERCEPT_CALL(DepthMask, States, (GLboolean flag), (flag))
+INTERCEPT_CALL(ColorMask, States, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+INTERCEPT_CALL(CullFace, States, (GLenum mode), (mode))
+INTERCEPT_CALL(FrontFace, States, (GLenum mode), (mode))
+INTERCEPT_CALL(PolygonMode, States, (GLenum face, GLenum mode), (face, mode))
+INTERCEPT_CALL(PolygonOffset, States, (GLfloat factor, GLfloat units), (factor, units))
+INTERCEPT_CALL(LineWidth, States, (GLfloat width), (width))
+INTERCEPT_CALL(PointSize, States, (GLfloat size), (size))
+INTERCEPT_CALL(Scissor, States, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+INTERCEPT_CALL(Viewport, States, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+INTERCEPT_CALL(StencilFunc, States, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+INTERCEPT_CALL(StencilOp, States, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+INTERCEPT_CALL(StencilMask, States, (GLuint mask), (mask))
+INTERCEPT_CALL(PixelStorei, States, (GLenum pname, GLint param), (pname, param))
+INTERCEPT_CALL(TexParameteri, States, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+INTERCEPT_CALL(TexParameterf, States, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
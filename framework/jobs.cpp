@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "jobs.hpp"
+
+jobs::jobs(std::size_t ThreadCount) :
+	Generation(0),
+	Stop(false),
+	Function(nullptr),
+	Count(0),
+	Remaining(0)
+{
+	for(std::size_t ThreadIndex = 1; ThreadIndex < ThreadCount; ++ThreadIndex)
+		this->Workers.push_back(std::thread(&jobs::work, this, ThreadIndex));
+}
+
+jobs::~jobs()
+{
+	{
+		std::lock_guard<std::mutex> Lock(this->Mutex);
+		this->Stop = true;
+	}
+	this->JobCondition.notify_all();
+	for(std::size_t WorkerIndex = 0; WorkerIndex < this->Workers.size(); ++WorkerIndex)
+		this->Workers[WorkerIndex].join();
+}
+
+void jobs::run(std::size_t Count, function const & Function)
+{
+	if(this->Workers.empty())
+	{
+		if(Count > 0)
+			Function(0, Count);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(this->Mutex);
+		this->Function = &Function;
+		this->Count = Count;
+		this->Remaining = this->Workers.size();
+		++this->Generation;
+	}
+	this->JobCondition.notify_all();
+
+	this->partition(0);
+
+	std::unique_lock<std::mutex> Lock(this->Mutex);
+	this->DoneCondition.wait(Lock, [&]{return this->Remaining == 0;});
+	this->Function = nullptr;
+}
+
+void jobs::work(std::size_t ThreadIndex)
+{
+	std::size_t Seen = 0;
+
+	for(;;)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->JobCondition.wait(Lock, [&]{return this->Stop || this->Generation != Seen;});
+			if(this->Stop)
+				return;
+			Seen = this->Generation;
+		}
+
+		this->partition(ThreadIndex);
+
+		bool Done = false;
+		{
+			std::lock_guard<std::mutex> Lock(this->Mutex);
+			Done = --this->Remaining == 0;
+		}
+		if(Done)
+			this->DoneCondition.notify_one();
+	}
+}
+
+void jobs::partition(std::size_t ThreadIndex) const
+{
+	std::size_t const ThreadCount = this->getThreadCount();
+	std::size_t const Begin = this->Count * ThreadIndex / ThreadCount;
+	std::size_t const End = this->Count * (ThreadIndex + 1) / ThreadCount;
+
+	if(Begin < End)
+		(*this->Function)(Begin, End);
+}
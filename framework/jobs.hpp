@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs a function over a range of items split in one contiguous partition per thread.
+// The thread calling run() processes the first partition and ThreadCount - 1 workers process the others,
+// so that each thread writes its own part of the output, typically a persistently mapped buffer, without lock.
+// The workers don't own a GL context, the function must not call GL.
+// The workers sleep on a condition variable between runs. Each worker decrements the Mutex protected
+// Remaining once its partition is done and the last one notifies DoneCondition, which run() waits on.
+class jobs
+{
+public:
+	// Processes the items in [Begin, End)
+	typedef std::function<void(std::size_t Begin, std::size_t End)> function;
+
+	explicit jobs(std::size_t ThreadCount);
+	~jobs();
+
+	std::size_t getThreadCount() const{return this->Workers.size() + 1;}
+
+	// Returns once Function processed all the items in [0, Count)
+	void run(std::size_t Count, function const & Function);
+
+private:
+	jobs(jobs const &);
+	jobs& operator=(jobs const &);
+
+	void work(std::size_t ThreadIndex);
+	void partition(std::size_t ThreadIndex) const;
+
+	std::mutex Mutex;
+	std::condition_variable JobCondition;
+	// Notified by the worker completing the last partition
+	std::condition_variable DoneCondition;
+	// Incremented by run() to wake the workers
+	std::size_t Generation;
+	bool Stop;
+	// Valid during run()
+	function const * Function;
+	std::size_t Count;
+	// Workers which haven't completed their partition yet
+	std::size_t Remaining;
+	std::vector<std::thread> Workers;
+};
@@ -24,6 +24,18 @@
 #include "png.hpp"
 #include <FreeImage.h>
 #include <cstdlib>
+#include <cstring>
+#include <string>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define OGL_SAMPLES_SSE2
+#	include <emmintrin.h>
+#endif
 
 namespace
 {
@@ -44,10 +56,142 @@ namespace
 			atexit(FreeImageFree);
 		}
 	}
+
+	// Copy a row swapping the first and third components: FreeImage stores BGR(A), gli RGB(A)
+	void swizzleRow(glm::u8 const * Src, glm::u8 * Dst, std::size_t Width, std::size_t Components)
+	{
+		std::size_t Texel = 0;
+
+#		if defined(OGL_SAMPLES_SSE2)
+		if(Components == 4)
+		{
+			__m128i const MaskGA = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+			__m128i const MaskLow = _mm_set1_epi32(0x000000FF);
+
+			for(; Texel + 4 <= Width; Texel += 4)
+			{
+				__m128i const Color = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Src + Texel * 4));
+				__m128i const Red = _mm_slli_epi32(_mm_and_si128(Color, MaskLow), 16);
+				__m128i const Blue = _mm_and_si128(_mm_srli_epi32(Color, 16), MaskLow);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Texel * 4), _mm_or_si128(_mm_and_si128(Color, MaskGA), _mm_or_si128(Red, Blue)));
+			}
+		}
+#		endif//OGL_SAMPLES_SSE2
+
+		for(; Texel < Width; ++Texel)
+		{
+			glm::u8 const * SrcTexel = Src + Texel * Components;
+			glm::u8 * DstTexel = Dst + Texel * Components;
+
+			DstTexel[0] = SrcTexel[2];
+			DstTexel[1] = SrcTexel[1];
+			DstTexel[2] = SrcTexel[0];
+			if(Components == 4)
+				DstTexel[3] = SrcTexel[3];
+		}
+	}
+
+	class writer
+	{
+		struct job
+		{
+			job(gli::texture2D const & Texture, char const * Filename) :
+				Texture(Texture),
+				Filename(Filename)
+			{}
+
+			gli::texture2D const Texture;
+			std::string const Filename;
+		};
+
+	public:
+		writer() :
+			Busy(false),
+			Exit(false)
+		{
+			// Registers FreeImage deinitialization before the writer destruction so that pending files are written first
+			FreeImageInit();
+			this->Thread = std::thread(&writer::run, this);
+		}
+
+		~writer()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(this->Mutex);
+				this->Exit = true;
+			}
+			this->Condition.notify_all();
+			this->Thread.join();
+		}
+
+		void push(gli::texture2D const & Texture, char const * Filename)
+		{
+			{
+				std::lock_guard<std::mutex> Lock(this->Mutex);
+				this->Jobs.push_back(job(Texture, Filename));
+			}
+			this->Condition.notify_all();
+		}
+
+		void flush()
+		{
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->Done.wait(Lock, [this]{return this->Jobs.empty() && !this->Busy;});
+		}
+
+	private:
+		void run()
+		{
+			for(;;)
+			{
+				std::unique_ptr<job> Job;
+				{
+					std::unique_lock<std::mutex> Lock(this->Mutex);
+					this->Condition.wait(Lock, [this]{return this->Exit || !this->Jobs.empty();});
+
+					// Drain the queue before exiting
+					if(this->Jobs.empty())
+						return;
+
+					Job.reset(new job(this->Jobs.front()));
+					this->Jobs.pop_front();
+					this->Busy = true;
+				}
+
+				save_png(Job->Texture, Job->Filename.c_str());
+
+				{
+					std::lock_guard<std::mutex> Lock(this->Mutex);
+					this->Busy = false;
+				}
+				this->Done.notify_all();
+			}
+		}
+
+		std::deque<job> Jobs;
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		std::condition_variable Done;
+		std::thread Thread;
+		bool Busy;
+		bool Exit;
+	};
+
+	writer & getWriter()
+	{
+		static writer Writer;
+		return Writer;
+	}
 }//namespace
 
 /// Loading a PNG file
 gli::texture2D load_png(char const * Filename)
+{
+	gli::texture2D Buffer;
+	return load_png(Filename, Buffer);
+}
+
+gli::texture2D load_png(char const * Filename, gli::texture2D & Buffer)
 {
 	FreeImageInit();
 
@@ -59,66 +203,37 @@ gli::texture2D load_png(char const * Filename)
 	glm::uint Width = FreeImage_GetWidth(Bitmap);
 	glm::uint Height = FreeImage_GetHeight(Bitmap);
 
-	gli::texture2D Texture(1, BPP == 24 ? gli::FORMAT_RGB8_UNORM : gli::FORMAT_RGBA8_UNORM, gli::texture2D::dim_type(Width, Height));
-	memcpy(Texture.data(), FreeImage_GetBits(Bitmap), Texture.size());
-	FreeImage_Unload(Bitmap);
+	gli::format const Format = BPP == 24 ? gli::FORMAT_RGB8_UNORM : gli::FORMAT_RGBA8_UNORM;
+	gli::texture2D::dim_type const Dimensions(Width, Height);
 
-	switch(gli::component_count(Texture.format()))
-	{
-	default:
-		assert(0);
-		break;
-	case 3:
-		for(std::size_t Offset = 0; Offset < Texture.size() / 3; ++Offset)
-		{
-			glm::u8vec3 Src = *(static_cast<glm::u8vec3 const *>(Texture.data()) + Offset);
-			*(static_cast<glm::u8vec3*>(Texture.data()) + Offset) = glm::u8vec3(Src.z, Src.y, Src.x);
-		}
-		break;
-	case 4:
-		for(std::size_t Offset = 0; Offset < Texture.size() / 4; ++Offset)
-		{
-			glm::u8vec4 Src = *(static_cast<glm::u8vec4 const *>(Texture.data()) + Offset);
-			*(static_cast<glm::u8vec4*>(Texture.data()) + Offset) = glm::u8vec4(Src.z, Src.y, Src.x, Src.w);
-		}
-		break;
-	}
+	bool const Reuse = !Buffer.empty() && Buffer.format() == Format && Buffer.dimensions() == Dimensions && Buffer.levels() == 1;
+	gli::texture2D Texture(Reuse ? Buffer : gli::texture2D(1, Format, Dimensions));
+
+	// FreeImage rows are padded to 4 bytes, swizzle each row straight into the texture
+	std::size_t const Components = gli::component_count(Format);
+	for(glm::uint y = 0; y < Height; ++y)
+		swizzleRow(FreeImage_GetScanLine(Bitmap, static_cast<int>(y)), Texture.data<glm::u8>() + y * Width * Components, Width, Components);
+
+	FreeImage_Unload(Bitmap);
 
 	return Texture;
 }
 
 void save_png(gli::texture2D const & Texture, char const * Filename)
 {
-	gli::texture2D Copy = gli::copy(Texture);
-
-	switch(gli::component_count(Copy.format()))
-	{
-	default:
-		assert(0);
-		break;
-	case 3:
-		for(std::size_t Offset = 0; Offset < Copy.size() / 3; ++Offset)
-		{
-			glm::u8vec3 Src = *(static_cast<glm::u8vec3 const *>(Copy.data()) + Offset);
-			*(static_cast<glm::u8vec3*>(Copy.data()) + Offset) = glm::u8vec3(Src.z, Src.y, Src.x);
-		}
-		break;
-	case 4:
-		for(std::size_t Offset = 0; Offset < Copy.size() / 4; ++Offset)
-		{
-			glm::u8vec4 Src = *(static_cast<glm::u8vec4 const *>(Copy.data()) + Offset);
-			*(static_cast<glm::u8vec4*>(Copy.data()) + Offset) = glm::u8vec4(Src.z, Src.y, Src.x, Src.w);
-		}
-		break;
-	}
+	std::size_t const Components = gli::component_count(Texture.format());
+	assert(Components == 3 || Components == 4);
 
 	FreeImageInit();
 
-	FIBITMAP* Bitmap = FreeImage_ConvertFromRawBits(
-		Copy.data<BYTE>(),
-		Copy.dimensions().x, Copy.dimensions().y,
-		static_cast<int>(Copy.dimensions().x * gli::component_count(Copy.format())),
-		static_cast<unsigned int>(gli::component_count(Copy.format()) * 8), 0x0000FF, 0x00FF00, 0xFF0000, false);
+	int const Width = static_cast<int>(Texture.dimensions().x);
+	int const Height = static_cast<int>(Texture.dimensions().y);
+
+	FIBITMAP* Bitmap = FreeImage_Allocate(Width, Height, static_cast<int>(Components * 8), 0xFF0000, 0x00FF00, 0x0000FF);
+	assert(Bitmap);
+
+	for(int y = 0; y < Height; ++y)
+		swizzleRow(Texture.data<glm::u8>() + y * Width * Components, FreeImage_GetScanLine(Bitmap, y), Width, Components);
 
 	BOOL Result = FreeImage_Save(FIF_PNG, Bitmap, Filename, 0);
 	assert(Result);
@@ -126,3 +241,12 @@ void save_png(gli::texture2D const & Texture, char const * Filename)
 	FreeImage_Unload(Bitmap);
 }
 
+void save_png_async(gli::texture2D const & Texture, char const * Filename)
+{
+	getWriter().push(Texture, Filename);
+}
+
+void flush_png()
+{
+	getWriter().flush();
+}
@@ -27,4 +27,10 @@
 #include <gli/gli.hpp>
 
 gli::texture2D load_png(char const * Filename);
+// Decode into the storage of Buffer when the format and dimensions match, the result then shares it
+gli::texture2D load_png(char const * Filename, gli::texture2D & Buffer);
 void save_png(gli::texture2D const & Texture, char const * Filename);
+// Queue the file on a background writer thread, Texture storage is shared until written
+void save_png_async(gli::texture2D const & Texture, char const * Filename);
+// Wait for all the queued files to be written
+void flush_png();
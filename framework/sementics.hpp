@@ -117,7 +117,9 @@ namespace semantic
 	{
 		enum type
 		{
-			VERTEX	= 0
+			VERTEX	= 0,
+			MATERIAL	= 1,
+			TRANSFORM	= 2
 		};
 	}//namespace storage
 }//namespace semantic
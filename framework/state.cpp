@@ -0,0 +1,319 @@
+#include "state.hpp"
+#include "intercept_gl11.hpp"
+#include <cassert>
+
+namespace
+{
+	// Never generated by GL, a binding set to this value is unknown to the cache
+	GLuint const UNKNOWN_NAME(~GLuint(0));
+
+	int bufferTargetIndex(GLenum Target)
+	{
+		switch(Target)
+		{
+		case GL_UNIFORM_BUFFER: return 0;
+		case GL_SHADER_STORAGE_BUFFER: return 1;
+		case GL_ATOMIC_COUNTER_BUFFER: return 2;
+		case GL_ARRAY_BUFFER: return 3;
+		case GL_ELEMENT_ARRAY_BUFFER: return 4;
+		case GL_DRAW_INDIRECT_BUFFER: return 5;
+		case GL_DISPATCH_INDIRECT_BUFFER: return 6;
+		case GL_PIXEL_PACK_BUFFER: return 7;
+		case GL_PIXEL_UNPACK_BUFFER: return 8;
+		case GL_PARAMETER_BUFFER_ARB: return 9;
+		default: return -1;
+		}
+	}
+
+	// The indexed targets are the first buffer targets
+	int indexedTargetIndex(GLenum Target)
+	{
+		int const Index = bufferTargetIndex(Target);
+		return Index < 3 ? Index : -1;
+	}
+
+	int textureTargetIndex(GLenum Target)
+	{
+		switch(Target)
+		{
+		case GL_TEXTURE_1D: return 0;
+		case GL_TEXTURE_2D: return 1;
+		case GL_TEXTURE_3D: return 2;
+		case GL_TEXTURE_1D_ARRAY: return 3;
+		case GL_TEXTURE_2D_ARRAY: return 4;
+		case GL_TEXTURE_RECTANGLE: return 5;
+		case GL_TEXTURE_CUBE_MAP: return 6;
+		case GL_TEXTURE_CUBE_MAP_ARRAY: return 7;
+		case GL_TEXTURE_BUFFER: return 8;
+		case GL_TEXTURE_2D_MULTISAMPLE: return 9;
+		case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 10;
+		default: return -1;
+		}
+	}
+
+	bool contains(GLsizei Count, GLuint const * Names, GLuint Name)
+	{
+		for(GLsizei Index = 0; Index < Count; ++Index)
+			if(Names[Index] == Name && Name != 0)
+				return true;
+		return false;
+	}
+
+	int capabilityIndex(GLenum Capability)
+	{
+		if(Capability >= GL_CLIP_DISTANCE0 && Capability < GL_CLIP_DISTANCE0 + 8)
+			return 17 + static_cast<int>(Capability - GL_CLIP_DISTANCE0);
+
+		switch(Capability)
+		{
+		case GL_BLEND: return 0;
+		case GL_CULL_FACE: return 1;
+		case GL_DEPTH_TEST: return 2;
+		case GL_STENCIL_TEST: return 3;
+		case GL_SCISSOR_TEST: return 4;
+		case GL_POLYGON_OFFSET_FILL: return 5;
+		case GL_RASTERIZER_DISCARD: return 6;
+		case GL_PRIMITIVE_RESTART: return 7;
+		case GL_PRIMITIVE_RESTART_FIXED_INDEX: return 8;
+		case GL_MULTISAMPLE: return 9;
+		case GL_SAMPLE_ALPHA_TO_COVERAGE: return 10;
+		case GL_SAMPLE_SHADING: return 11;
+		case GL_FRAMEBUFFER_SRGB: return 12;
+		case GL_PROGRAM_POINT_SIZE: return 13;
+		case GL_DEPTH_CLAMP: return 14;
+		case GL_TEXTURE_CUBE_MAP_SEAMLESS: return 15;
+		case GL_DITHER: return 16;
+		default: return -1;
+		}
+	}
+}//namespace
+
+namespace gl
+{
+	state::state()
+	{
+		this->invalidate();
+	}
+
+	void state::invalidate()
+	{
+		range const Unknown = {UNKNOWN_NAME, 0, 0};
+
+		this->Program = UNKNOWN_NAME;
+		this->Pipeline = UNKNOWN_NAME;
+		this->VertexArray = UNKNOWN_NAME;
+		this->Buffers.fill(UNKNOWN_NAME);
+		for(std::size_t TargetIndex = 0; TargetIndex < this->Ranges.size(); ++TargetIndex)
+			this->Ranges[TargetIndex].fill(Unknown);
+		this->ActiveTexture = UNKNOWN_NAME;
+		for(std::size_t Unit = 0; Unit < this->Textures.size(); ++Unit)
+			this->Textures[Unit].fill(UNKNOWN_NAME);
+		this->Samplers.fill(UNKNOWN_NAME);
+		this->EnableKnown = 0;
+		this->EnableValue = 0;
+	}
+
+	bool state::forward(bool Redundant)
+	{
+		if(Redundant)
+			++this->Stats.Filtered;
+		else
+			++this->Stats.Forwarded;
+		return !Redundant;
+	}
+
+	void state::useProgram(GLuint Program)
+	{
+		if(!this->forward(this->Program == Program))
+			return;
+
+		this->Program = Program;
+		glUseProgram(Program);
+	}
+
+	void state::bindProgramPipeline(GLuint Pipeline)
+	{
+		if(!this->forward(this->Pipeline == Pipeline))
+			return;
+
+		this->Pipeline = Pipeline;
+		glBindProgramPipeline(Pipeline);
+	}
+
+	void state::bindVertexArray(GLuint VertexArray)
+	{
+		if(!this->forward(this->VertexArray == VertexArray))
+			return;
+
+		this->VertexArray = VertexArray;
+		glBindVertexArray(VertexArray);
+
+		// The element array buffer binding is a vertex array object state
+		this->Buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN_NAME;
+	}
+
+	void state::bindBuffer(GLenum Target, GLuint Buffer)
+	{
+		int const TargetIndex = bufferTargetIndex(Target);
+
+		if(!this->forward(TargetIndex >= 0 && this->Buffers[TargetIndex] == Buffer))
+			return;
+
+		if(TargetIndex >= 0)
+			this->Buffers[TargetIndex] = Buffer;
+		glBindBuffer(Target, Buffer);
+	}
+
+	void state::bindBufferBase(GLenum Target, GLuint Index, GLuint Buffer)
+	{
+		this->bindBufferRange(Target, Index, Buffer, 0, 0);
+	}
+
+	void state::bindBufferRange(GLenum Target, GLuint Index, GLuint Buffer, GLintptr Offset, GLsizeiptr Size)
+	{
+		int const TargetIndex = indexedTargetIndex(Target);
+		bool const Tracked = TargetIndex >= 0 && Index < BUFFER_INDEX_MAX;
+
+		range & Range = this->Ranges[Tracked ? TargetIndex : 0][Tracked ? Index : 0];
+		if(!this->forward(Tracked && Range.Buffer == Buffer && Range.Offset == Offset && Range.Size == Size))
+			return;
+
+		if(Tracked)
+		{
+			Range.Buffer = Buffer;
+			Range.Offset = Offset;
+			Range.Size = Size;
+		}
+
+		// Indexed binding functions also bind the generic binding point of the target
+		int const GenericIndex = bufferTargetIndex(Target);
+		if(GenericIndex >= 0)
+			this->Buffers[GenericIndex] = Buffer;
+
+		if(Size == 0)
+			glBindBufferBase(Target, Index, Buffer);
+		else
+			glBindBufferRange(Target, Index, Buffer, Offset, Size);
+	}
+
+	void state::bindTexture(GLuint Unit, GLenum Target, GLuint Texture)
+	{
+		int const TargetIndex = textureTargetIndex(Target);
+		bool const Tracked = TargetIndex >= 0 && Unit < TEXTURE_UNIT_MAX;
+
+		if(!this->forward(Tracked && this->Textures[Unit][TargetIndex] == Texture))
+			return;
+
+		if(this->ActiveTexture != Unit)
+		{
+			this->ActiveTexture = Unit;
+			glActiveTexture(GL_TEXTURE0 + Unit);
+		}
+
+		if(Tracked)
+			this->Textures[Unit][TargetIndex] = Texture;
+		glBindTexture(Target, Texture);
+	}
+
+	void state::bindSampler(GLuint Unit, GLuint Sampler)
+	{
+		bool const Tracked = Unit < TEXTURE_UNIT_MAX;
+
+		if(!this->forward(Tracked && this->Samplers[Unit] == Sampler))
+			return;
+
+		if(Tracked)
+			this->Samplers[Unit] = Sampler;
+		glBindSampler(Unit, Sampler);
+	}
+
+	void state::enable(GLenum Capability)
+	{
+		this->setEnabled(Capability, true);
+	}
+
+	void state::disable(GLenum Capability)
+	{
+		this->setEnabled(Capability, false);
+	}
+
+	void state::setEnabled(GLenum Capability, bool Enabled)
+	{
+		int const Index = capabilityIndex(Capability);
+		std::uint32_t const Bit = Index >= 0 ? 1u << Index : 0u;
+
+		if(!this->forward(Bit && (this->EnableKnown & Bit) && ((this->EnableValue & Bit) != 0) == Enabled))
+			return;
+
+		this->EnableKnown |= Bit;
+		if(Enabled)
+		{
+			this->EnableValue |= Bit;
+			glEnable(Capability);
+		}
+		else
+		{
+			this->EnableValue &= ~Bit;
+			glDisable(Capability);
+		}
+	}
+
+	// glDeleteProgram keeps a current program in use until it is no longer current, the cache forwards the next glUseProgram anyway
+	void state::deleteProgram(GLuint Program)
+	{
+		if(this->Program == Program && Program != 0)
+			this->Program = UNKNOWN_NAME;
+		glDeleteProgram(Program);
+	}
+
+	void state::deleteProgramPipelines(GLsizei Count, GLuint const * Pipelines)
+	{
+		if(contains(Count, Pipelines, this->Pipeline))
+			this->Pipeline = UNKNOWN_NAME;
+		glDeleteProgramPipelines(Count, Pipelines);
+	}
+
+	void state::deleteVertexArrays(GLsizei Count, GLuint const * VertexArrays)
+	{
+		if(contains(Count, VertexArrays, this->VertexArray))
+		{
+			this->VertexArray = UNKNOWN_NAME;
+			this->Buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN_NAME;
+		}
+		glDeleteVertexArrays(Count, VertexArrays);
+	}
+
+	void state::deleteBuffers(GLsizei Count, GLuint const * Buffers)
+	{
+		for(std::size_t TargetIndex = 0; TargetIndex < this->Buffers.size(); ++TargetIndex)
+			if(contains(Count, Buffers, this->Buffers[TargetIndex]))
+				this->Buffers[TargetIndex] = UNKNOWN_NAME;
+
+		range const Unknown = {UNKNOWN_NAME, 0, 0};
+		for(std::size_t TargetIndex = 0; TargetIndex < this->Ranges.size(); ++TargetIndex)
+			for(std::size_t Index = 0; Index < this->Ranges[TargetIndex].size(); ++Index)
+				if(contains(Count, Buffers, this->Ranges[TargetIndex][Index].Buffer))
+					this->Ranges[TargetIndex][Index] = Unknown;
+
+		glDeleteBuffers(Count, Buffers);
+	}
+
+	void state::deleteTextures(GLsizei Count, GLuint const * Textures)
+	{
+		for(std::size_t Unit = 0; Unit < this->Textures.size(); ++Unit)
+			for(std::size_t TargetIndex = 0; TargetIndex < this->Textures[Unit].size(); ++TargetIndex)
+				if(contains(Count, Textures, this->Textures[Unit][TargetIndex]))
+					this->Textures[Unit][TargetIndex] = UNKNOWN_NAME;
+
+		glDeleteTextures(Count, Textures);
+	}
+
+	void state::deleteSamplers(GLsizei Count, GLuint const * Samplers)
+	{
+		for(std::size_t Unit = 0; Unit < this->Samplers.size(); ++Unit)
+			if(contains(Count, Samplers, this->Samplers[Unit]))
+				this->Samplers[Unit] = UNKNOWN_NAME;
+
+		glDeleteSamplers(Count, Samplers);
+	}
+}//namespace gl
@@ -0,0 +1,97 @@
+#ifndef STATE_INCLUDED
+#define STATE_INCLUDED
+
+#include "buffer.hpp"
+#include <array>
+
+namespace gl
+{
+	// Shadow of the object bindings and enable bits: calls that would not change the current state are
+	// dropped before reaching the driver. The cache only knows the state set through it, after changing
+	// this state directly call invalidate() so that the next calls are forwarded.
+	// Delete objects through the cache: GL unbinds deleted objects and may return their names again,
+	// a binding still holding a deleted name would filter the binding of the new object.
+	// Buffer targets, capabilities and texture units the cache doesn't track are always forwarded.
+	class state : noncopyable
+	{
+	public:
+		enum
+		{
+			TEXTURE_UNIT_MAX = 32,
+			BUFFER_INDEX_MAX = 16
+		};
+
+		struct stats
+		{
+			stats() :
+				Forwarded(0),
+				Filtered(0)
+			{}
+
+			std::size_t Forwarded;
+			std::size_t Filtered;
+		};
+
+		state();
+
+		void invalidate();
+
+		void useProgram(GLuint Program);
+		void bindProgramPipeline(GLuint Pipeline);
+		void bindVertexArray(GLuint VertexArray);
+		void bindBuffer(GLenum Target, GLuint Buffer);
+		void bindBufferBase(GLenum Target, GLuint Index, GLuint Buffer);
+		void bindBufferRange(GLenum Target, GLuint Index, GLuint Buffer, GLintptr Offset, GLsizeiptr Size);
+		// Selects the texture unit with glActiveTexture when the binding changes
+		void bindTexture(GLuint Unit, GLenum Target, GLuint Texture);
+		void bindSampler(GLuint Unit, GLuint Sampler);
+		void enable(GLenum Capability);
+		void disable(GLenum Capability);
+
+		// Forward the deletion and forget the bindings of the deleted names
+		void deleteProgram(GLuint Program);
+		void deleteProgramPipelines(GLsizei Count, GLuint const * Pipelines);
+		void deleteVertexArrays(GLsizei Count, GLuint const * VertexArrays);
+		void deleteBuffers(GLsizei Count, GLuint const * Buffers);
+		void deleteTextures(GLsizei Count, GLuint const * Textures);
+		void deleteSamplers(GLsizei Count, GLuint const * Samplers);
+
+		stats const & getStats() const{return this->Stats;}
+		void resetStats(){this->Stats = stats();}
+
+	private:
+		enum
+		{
+			BUFFER_TARGET_MAX = 10,
+			INDEXED_TARGET_MAX = 3,
+			TEXTURE_TARGET_MAX = 11
+		};
+
+		struct range
+		{
+			GLuint Buffer;
+			GLintptr Offset;
+			// 0 for a glBindBufferBase binding
+			GLsizeiptr Size;
+		};
+
+		// Returns true when the call must be forwarded
+		bool forward(bool Redundant);
+		void setEnabled(GLenum Capability, bool Enabled);
+
+		GLuint Program;
+		GLuint Pipeline;
+		GLuint VertexArray;
+		std::array<GLuint, BUFFER_TARGET_MAX> Buffers;
+		std::array<std::array<range, BUFFER_INDEX_MAX>, INDEXED_TARGET_MAX> Ranges;
+		GLuint ActiveTexture;
+		std::array<std::array<GLuint, TEXTURE_TARGET_MAX>, TEXTURE_UNIT_MAX> Textures;
+		std::array<GLuint, TEXTURE_UNIT_MAX> Samplers;
+		// Capabilities with a known state and their value, one bit per tracked capability
+		std::uint32_t EnableKnown;
+		std::uint32_t EnableValue;
+		stats Stats;
+	};
+}//namespace gl
+
+#endif//STATE_INCLUDED
@@ -0,0 +1,377 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "streaming.hpp"
+#include "intercept_gl11.hpp"
+#include <glm/gtc/round.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+	// Keeps every slot offset aligned for any texel type
+	std::size_t const SLOT_ALIGNMENT(256);
+
+	// The chunks are tightly packed rows, these unpack parameters are set while issuing them
+	GLenum const UNPACK_PARAMETERS[] =
+	{
+		GL_UNPACK_ALIGNMENT,
+		GL_UNPACK_ROW_LENGTH,
+		GL_UNPACK_IMAGE_HEIGHT,
+		GL_UNPACK_SKIP_PIXELS,
+		GL_UNPACK_SKIP_ROWS,
+		GL_UNPACK_SKIP_IMAGES
+	};
+	GLint const UNPACK_PACKED[] = {1, 0, 0, 0, 0, 0};
+
+	std::size_t const UNPACK_PARAMETER_COUNT(sizeof(UNPACK_PARAMETERS) / sizeof(GLenum));
+
+	struct unpackState
+	{
+		GLint Buffer;
+		std::array<GLint, UNPACK_PARAMETER_COUNT> Values;
+	};
+
+	// Binds Buffer for tightly packed rows and returns the caller's unpack state
+	unpackState beginUnpack(GLuint Buffer)
+	{
+		unpackState State;
+		glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &State.Buffer);
+		for(std::size_t Index = 0; Index < UNPACK_PARAMETER_COUNT; ++Index)
+		{
+			glGetIntegerv(UNPACK_PARAMETERS[Index], &State.Values[Index]);
+			glPixelStorei(UNPACK_PARAMETERS[Index], UNPACK_PACKED[Index]);
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, Buffer);
+
+		return State;
+	}
+
+	void endUnpack(unpackState const & State)
+	{
+		for(std::size_t Index = 0; Index < UNPACK_PARAMETER_COUNT; ++Index)
+			glPixelStorei(UNPACK_PARAMETERS[Index], State.Values[Index]);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(State.Buffer));
+	}
+}//namespace
+
+streamer::chunk::chunk() :
+	Source(nullptr),
+	Size(0),
+	Target(GL_NONE),
+	TextureName(0),
+	Level(0),
+	Layer(0),
+	OffsetY(0),
+	Width(0),
+	Height(0),
+	Internal(GL_NONE),
+	External(GL_NONE),
+	Type(GL_NONE),
+	Compressed(false)
+{}
+
+streamer::streamer(std::size_t SlotCount, std::size_t SlotSize, std::size_t WorkerCount) :
+	SlotSize(glm::ceilMultiple(SlotSize, SLOT_ALIGNMENT)),
+	Slots(SlotCount),
+	Mapped(nullptr),
+	Filling(0),
+	Stop(false)
+{
+	if(SlotCount == 0 || !(GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage))
+		return;
+
+	// Explicit flushes rather than a coherent mapping so that the driver may place the buffer in write combined memory
+	this->Buffer.reset(new gl::buffer(gl::buffer::WRITE_BIT | gl::buffer::PERSISTENT_BIT, SlotCount * this->SlotSize));
+	this->Mapped = static_cast<glm::byte*>(this->Buffer->data());
+
+	if(!this->Mapped)
+		return;
+
+	for(std::size_t SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
+		this->Free.push_back(SlotIndex);
+
+	for(std::size_t WorkerIndex = 0; WorkerIndex < WorkerCount; ++WorkerIndex)
+		this->Workers.push_back(std::thread(&streamer::work, this));
+}
+
+streamer::~streamer()
+{
+	{
+		std::lock_guard<std::mutex> Lock(this->Mutex);
+		this->Stop = true;
+	}
+	this->JobCondition.notify_all();
+	for(std::size_t WorkerIndex = 0; WorkerIndex < this->Workers.size(); ++WorkerIndex)
+		this->Workers[WorkerIndex].join();
+
+	for(std::size_t SlotIndex = 0; SlotIndex < this->Slots.size(); ++SlotIndex)
+		if(this->Slots[SlotIndex].Fence)
+			glDeleteSync(this->Slots[SlotIndex].Fence);
+}
+
+bool streamer::isValid() const
+{
+	return this->Mapped != nullptr;
+}
+
+bool streamer::idle() const
+{
+	return this->Pending.empty() && this->Filling == 0;
+}
+
+void streamer::upload(GLuint TextureName, gli::texture2D const & Texture)
+{
+	std::shared_ptr<gli::texture const> Source(new gli::texture2D(Texture));
+
+	for(gli::texture2D::size_type Level = 0; Level < Texture.levels(); ++Level)
+		this->queue(Source, GL_TEXTURE_2D, TextureName, 0, static_cast<GLint>(Level),
+			Texture[Level].data<glm::byte>(), glm::ivec2(Texture[Level].dimensions()));
+}
+
+void streamer::upload(GLuint TextureName, gli::texture2DArray const & Texture)
+{
+	std::shared_ptr<gli::texture const> Source(new gli::texture2DArray(Texture));
+
+	for(gli::texture2DArray::size_type Layer = 0; Layer < Texture.layers(); ++Layer)
+	for(gli::texture2DArray::size_type Level = 0; Level < Texture.levels(); ++Level)
+		this->queue(Source, GL_TEXTURE_2D_ARRAY, TextureName, static_cast<GLint>(Layer), static_cast<GLint>(Level),
+			Texture[Layer][Level].data<glm::byte>(), glm::ivec2(Texture[Layer][Level].dimensions()));
+}
+
+void streamer::queue
+(
+	std::shared_ptr<gli::texture const> const & Texture,
+	GLenum Target, GLuint TextureName, GLint Layer, GLint Level,
+	glm::byte const * Data, glm::ivec2 const & Size
+)
+{
+	gli::format const Format = Texture->format();
+	gli::gl GL;
+	gli::gl::format const FormatGL = GL.translate(Format);
+
+	// A row is a row of blocks, a single texel row for uncompressed formats
+	GLint const BlockHeight = static_cast<GLint>(gli::block_dimensions_y(Format));
+	std::size_t const BlockCountX = (Size.x + gli::block_dimensions_x(Format) - 1) / gli::block_dimensions_x(Format);
+	std::size_t const RowCount = (Size.y + BlockHeight - 1) / BlockHeight;
+	std::size_t const RowSize = BlockCountX * gli::block_size(Format);
+
+	chunk Chunk;
+	Chunk.Texture = Texture;
+	Chunk.Target = Target;
+	Chunk.TextureName = TextureName;
+	Chunk.Level = Level;
+	Chunk.Layer = Layer;
+	Chunk.Width = Size.x;
+	Chunk.Internal = FormatGL.Internal;
+	Chunk.External = FormatGL.External;
+	Chunk.Type = FormatGL.Type;
+	Chunk.Compressed = gli::is_compressed(Format);
+
+	// A single row doesn't fit in a slot, upload the level synchronously from client memory
+	if(RowSize > this->SlotSize)
+	{
+		Chunk.Source = Data;
+		Chunk.Size = RowCount * RowSize;
+		Chunk.Height = Size.y;
+
+		unpackState const State = beginUnpack(0);
+		this->issue(Chunk, Data);
+		endUnpack(State);
+
+		++this->Stats.SynchronousUploads;
+		this->Stats.SynchronousBytes += Chunk.Size;
+		return;
+	}
+
+	std::size_t const RowsPerChunk = this->SlotSize / RowSize;
+	for(std::size_t Row = 0; Row < RowCount; Row += RowsPerChunk)
+	{
+		std::size_t const Rows = std::min(RowsPerChunk, RowCount - Row);
+
+		Chunk.Source = Data + Row * RowSize;
+		Chunk.Size = Rows * RowSize;
+		Chunk.OffsetY = static_cast<GLint>(Row) * BlockHeight;
+		Chunk.Height = std::min(static_cast<GLint>(Rows) * BlockHeight, Size.y - Chunk.OffsetY);
+		this->Pending.push_back(Chunk);
+	}
+}
+
+void streamer::issue(chunk const & Chunk, void const * Pointer) const
+{
+	glBindTexture(Chunk.Target, Chunk.TextureName);
+
+	if(Chunk.Target == GL_TEXTURE_2D_ARRAY)
+	{
+		if(Chunk.Compressed)
+			glCompressedTexSubImage3D(Chunk.Target, Chunk.Level,
+				0, Chunk.OffsetY, Chunk.Layer, Chunk.Width, Chunk.Height, 1,
+				Chunk.Internal, static_cast<GLsizei>(Chunk.Size), Pointer);
+		else
+			glTexSubImage3D(Chunk.Target, Chunk.Level,
+				0, Chunk.OffsetY, Chunk.Layer, Chunk.Width, Chunk.Height, 1,
+				Chunk.External, Chunk.Type, Pointer);
+	}
+	else
+	{
+		if(Chunk.Compressed)
+			glCompressedTexSubImage2D(Chunk.Target, Chunk.Level,
+				0, Chunk.OffsetY, Chunk.Width, Chunk.Height,
+				Chunk.Internal, static_cast<GLsizei>(Chunk.Size), Pointer);
+		else
+			glTexSubImage2D(Chunk.Target, Chunk.Level,
+				0, Chunk.OffsetY, Chunk.Width, Chunk.Height,
+				Chunk.External, Chunk.Type, Pointer);
+	}
+}
+
+void streamer::fill(std::size_t SlotIndex)
+{
+	chunk const & Chunk = this->Slots[SlotIndex].Chunk;
+	memcpy(this->Mapped + SlotIndex * this->SlotSize, Chunk.Source, Chunk.Size);
+}
+
+void streamer::work()
+{
+	for(;;)
+	{
+		std::size_t SlotIndex = 0;
+		{
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->JobCondition.wait(Lock, [this]{return this->Stop || !this->Jobs.empty();});
+			if(this->Stop)
+				return;
+			SlotIndex = this->Jobs.front();
+			this->Jobs.pop_front();
+		}
+
+		this->fill(SlotIndex);
+
+		{
+			std::lock_guard<std::mutex> Lock(this->Mutex);
+			this->Ready.push_back(SlotIndex);
+		}
+		this->ReadyCondition.notify_one();
+	}
+}
+
+std::size_t streamer::update()
+{
+	if(!this->isValid())
+		return 0;
+
+	// Fences signal in submission order, stop at the first pending one
+	while(!this->InFlight.empty())
+	{
+		slot & Slot = this->Slots[this->InFlight.front()];
+		if(glClientWaitSync(Slot.Fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+			break;
+		glDeleteSync(Slot.Fence);
+		Slot.Fence = nullptr;
+		this->Free.push_back(this->InFlight.front());
+		this->InFlight.pop_front();
+	}
+
+	if(!this->Pending.empty() && !this->Free.empty())
+	{
+		std::lock_guard<std::mutex> Lock(this->Mutex);
+		while(!this->Pending.empty() && !this->Free.empty())
+		{
+			std::size_t const SlotIndex = this->Free.front();
+			this->Free.pop_front();
+			this->Slots[SlotIndex].Chunk = this->Pending.front();
+			this->Pending.pop_front();
+			++this->Filling;
+
+			if(this->Workers.empty())
+			{
+				this->fill(SlotIndex);
+				this->Ready.push_back(SlotIndex);
+			}
+			else
+				this->Jobs.push_back(SlotIndex);
+		}
+		this->JobCondition.notify_all();
+	}
+
+	std::vector<std::size_t> Filled;
+	{
+		std::lock_guard<std::mutex> Lock(this->Mutex);
+		Filled.swap(this->Ready);
+	}
+
+	if(Filled.empty())
+		return 0;
+
+	std::size_t Bytes = 0;
+
+	for(std::size_t FilledIndex = 0; FilledIndex < Filled.size(); ++FilledIndex)
+		this->Buffer->flush(Filled[FilledIndex] * this->SlotSize, this->Slots[Filled[FilledIndex]].Chunk.Size);
+
+	unpackState const State = beginUnpack(this->Buffer->name());
+
+	for(std::size_t FilledIndex = 0; FilledIndex < Filled.size(); ++FilledIndex)
+	{
+		std::size_t const SlotIndex = Filled[FilledIndex];
+		std::size_t const Offset = SlotIndex * this->SlotSize;
+		slot & Slot = this->Slots[SlotIndex];
+
+		this->issue(Slot.Chunk, reinterpret_cast<void const*>(Offset));
+		Slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		Bytes += Slot.Chunk.Size;
+		Slot.Chunk.Texture.reset();
+		this->InFlight.push_back(SlotIndex);
+		--this->Filling;
+	}
+
+	endUnpack(State);
+
+	return Bytes;
+}
+
+std::size_t streamer::finish()
+{
+	std::size_t Bytes = 0;
+
+	while(this->isValid())
+	{
+		Bytes += this->update();
+		if(this->idle())
+			break;
+
+		if(this->Filling > 0)
+		{
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->ReadyCondition.wait(Lock, [this]{return !this->Ready.empty();});
+		}
+		else if(this->Free.empty() && !this->InFlight.empty())
+		{
+			GLsync const Fence = this->Slots[this->InFlight.front()].Fence;
+			while(glClientWaitSync(Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED){}
+		}
+	}
+
+	return Bytes;
+}
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Samples Pack (ogl-samples.g-truc.net)
+///
+/// Copyright (c) 2004 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "buffer.hpp"
+#include <gli/gli.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Asynchronous texture uploads through a ring of persistently mapped pixel unpack buffers.
+// Uploads are split in chunks of whole texel rows, or block rows for compressed formats, which fit in a slot.
+// Worker threads copy the chunks into free slots, the render thread issues glTexSubImage* from the
+// filled slots and fences them, a slot is reused once its fence is signaled.
+// Requires GL_ARB_buffer_storage, all the member functions must be called from the thread owning the context.
+class streamer
+{
+public:
+	struct stats
+	{
+		stats() :
+			SynchronousUploads(0),
+			SynchronousBytes(0)
+		{}
+
+		// Levels whose rows don't fit in a slot, uploaded from client memory by upload() without going through the ring
+		std::size_t SynchronousUploads;
+		std::size_t SynchronousBytes;
+	};
+
+	// SlotCount slots of SlotSize bytes, with WorkerCount threads filling them.
+	// Without worker thread, the slots are filled by update() on the render thread.
+	streamer(std::size_t SlotCount, std::size_t SlotSize, std::size_t WorkerCount);
+	~streamer();
+
+	bool isValid() const;
+
+	// Queue all the levels of Texture. The storage of TextureName must already be allocated,
+	// Texture is kept alive until its last chunk has been copied. The unpack state of the caller is preserved.
+	void upload(GLuint TextureName, gli::texture2D const & Texture);
+	void upload(GLuint TextureName, gli::texture2DArray const & Texture);
+
+	// Call once per frame: issue the uploads of the filled slots, recycle the slots whose fence
+	// is signaled and hand free slots to the workers. Returns the number of bytes uploaded through the ring.
+	// The uploaded textures are bound on the active texture unit, the unpack state of the caller is preserved.
+	std::size_t update();
+	// Issue all the queued uploads, waiting on the workers and the fences as needed. Returns the number of bytes uploaded.
+	std::size_t finish();
+	// True when every queued upload has been issued to GL
+	bool idle() const;
+
+	std::size_t getSlotCount() const{return this->Slots.size();}
+	std::size_t getSlotSize() const{return this->SlotSize;}
+
+	stats const & getStats() const{return this->Stats;}
+	void resetStats(){this->Stats = stats();}
+
+private:
+	streamer(streamer const &);
+	streamer& operator=(streamer const &);
+
+	struct chunk
+	{
+		chunk();
+
+		std::shared_ptr<gli::texture const> Texture;
+		glm::byte const * Source;
+		std::size_t Size;
+		GLenum Target;
+		GLuint TextureName;
+		GLint Level;
+		GLint Layer;
+		GLint OffsetY;
+		GLsizei Width;
+		GLsizei Height;
+		GLenum Internal;
+		GLenum External;
+		GLenum Type;
+		bool Compressed;
+	};
+
+	struct slot
+	{
+		slot() : Fence(nullptr) {}
+
+		chunk Chunk;
+		GLsync Fence;
+	};
+
+	void queue(std::shared_ptr<gli::texture const> const & Texture, GLenum Target, GLuint TextureName, GLint Layer, GLint Level, glm::byte const * Data, glm::ivec2 const & Size);
+	void issue(chunk const & Chunk, void const * Pointer) const;
+	void fill(std::size_t SlotIndex);
+	void work();
+
+	std::size_t const SlotSize;
+	std::vector<slot> Slots;
+	std::unique_ptr<gl::buffer> Buffer;
+	glm::byte* Mapped;
+
+	// Render thread only
+	std::deque<chunk> Pending;
+	std::deque<std::size_t> Free;
+	std::deque<std::size_t> InFlight;
+	std::size_t Filling;
+	stats Stats;
+
+	// Shared with the workers
+	std::mutex Mutex;
+	std::condition_variable JobCondition;
+	std::condition_variable ReadyCondition;
+	std::deque<std::size_t> Jobs;
+	std::vector<std::size_t> Ready;
+	bool Stop;
+	std::vector<std::thread> Workers;
+};
@@ -23,11 +23,26 @@
 
 #include "test.hpp"
 #include "png.hpp"
+#include "compare.hpp"
 #include <glm/gtc/matrix_transform.hpp>
 #include <fstream>
+#include <chrono>
 
 namespace
 {
+	// Steady so that CPU times can be correlated with GPU timestamps over a whole run
+	typedef std::chrono::steady_clock cpuClock;
+
+	inline double elapsedMicroseconds(cpuClock::time_point Begin, cpuClock::time_point End)
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count()) / 1000.0;
+	}
+
+	inline GLint64 cpuNanoseconds()
+	{
+		return static_cast<GLint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(cpuClock::now().time_since_epoch()).count());
+	}
+
 	inline std::string vendor()
 	{
 		std::string String(reinterpret_cast<char const *>(glGetString(GL_VENDOR)));
@@ -72,6 +87,56 @@ namespace
 			}
 		}
 	}
+
+	// Window or headless surface kept alive between tests while test::beginSharedContext is active
+	struct sharedContext
+	{
+		sharedContext() :
+			Enabled(false),
+			Window(nullptr),
+			Profile(0),
+			Major(0),
+			Minor(0),
+			Size(0)
+		{}
+
+		bool matches(int Profile, int Major, int Minor, glm::uvec2 const & Size, bool Headless) const
+		{
+			return (this->Window || this->Headless) && (this->Headless != nullptr) == Headless &&
+				this->Profile == Profile && this->Major == Major && this->Minor == Minor && this->Size == Size;
+		}
+
+		void release()
+		{
+			this->Caps.reset();
+			this->Extensions.reset();
+			this->Headless.reset();
+			if(this->Window)
+				glfwDestroyWindow(this->Window);
+			this->Window = nullptr;
+		}
+
+		bool Enabled;
+		GLFWwindow* Window;
+		std::unique_ptr<headless> Headless;
+		std::unique_ptr<caps> Caps;
+		std::unique_ptr<extensionSet> Extensions;
+		int Profile;
+		int Major;
+		int Minor;
+		glm::uvec2 Size;
+	} SharedContext;
+
+	// Templates of consecutive tests usually share dimensions, decode them in the same buffer
+	gli::texture2D loadTemplate(std::string const & Filename)
+	{
+		static std::unique_ptr<gli::texture2D> Buffer(new gli::texture2D);
+
+		gli::texture2D Template(load_png(Filename.c_str(), *Buffer));
+		if(!Template.empty() && Template.data() != Buffer->data())
+			Buffer.reset(new gli::texture2D(Template));
+		return Template;
+	}
 }//namespace
 
 std::string getDataDirectory()
@@ -139,11 +204,23 @@ test::test
 	Profile(Profile),
 	Major(Major),
 	Minor(Minor),
-	TimerQueryName(0),
+	TimerQueryFirst(0),
+	TimerQueryPending(0),
+	TimerFrame(0),
+	TimestampQueryFirst(0),
+	TimestampQueryPending(0),
+	TimestampOffset(0),
+	TimestampSupported(false),
+	FrameDrawCount(0),
+	FrameDispatchCount(0),
+	FrameUploadSize(0),
+	FrameTexelCount(0),
+	CPUTimeSamples(false),
+	Skipped(false),
+	CountCalls(intercept::isRequested(argc, argv)),
 	FrameCount(FrameCount),
-	TimeSum(0.0),
-	TimeMin(std::numeric_limits<double>::max()),
-	TimeMax(0.0),
+	TemplateTolerance(0),
+	TemplateMaxErrorCount(0),
 	MouseOrigin(WindowSize >> 1u),
 	MouseCurrent(WindowSize >> 1u),
 	TranlationOrigin(Position),
@@ -151,11 +228,79 @@ test::test
 	RotationOrigin(Orientation), 
 	RotationCurrent(Orientation),
 	MouseButtonFlags(0),
+	Stop(false),
 	Error(false)
 {
 	assert(WindowSize.x > 0 && WindowSize.y > 0);
 
 	memset(&KeyPressed[0], 0, sizeof(KeyPressed));
+	this->TimerQueryName.fill(0);
+	this->TimerQueryFrame.fill(0);
+	this->TimestampQueryName.fill(0);
+	this->TimestampSubmit.fill(0);
+	this->TimeSamples.reserve(FrameCount + 1);
+	this->RenderSamples.reserve(FrameCount + 1);
+	this->SwapSamples.reserve(FrameCount + 1);
+	this->PollSamples.reserve(FrameCount + 1);
+	this->GPUFrameSamples.reserve(FrameCount + 1);
+	this->LatencySamples.reserve(FrameCount + 1);
+	this->DrawRateSamples.reserve(FrameCount + 1);
+	this->DispatchRateSamples.reserve(FrameCount + 1);
+	this->UploadRateSamples.reserve(FrameCount + 1);
+	this->TexelRateSamples.reserve(FrameCount + 1);
+	if(this->CountCalls)
+	{
+		this->DrawCallSamples.reserve(FrameCount + 1);
+		this->BindSamples.reserve(FrameCount + 1);
+		this->UniformSamples.reserve(FrameCount + 1);
+		this->StateSamples.reserve(FrameCount + 1);
+		this->UploadSamples.reserve(FrameCount + 1);
+		this->UploadedByteSamples.reserve(FrameCount + 1);
+	}
+
+	bool const Headless = headless::isRequested(argc, argv);
+
+	if(SharedContext.Enabled)
+	{
+		if(SharedContext.matches(Profile, Major, Minor, WindowSize, Headless))
+		{
+			this->Window = SharedContext.Window;
+			this->Headless = std::move(SharedContext.Headless);
+			this->Caps = std::move(SharedContext.Caps);
+			this->Extensions = std::move(SharedContext.Extensions);
+			SharedContext.Window = nullptr;
+
+			if(this->Window)
+			{
+				glfwSetWindowShouldClose(this->Window, GL_FALSE);
+				this->initWindow();
+			}
+
+			this->resetState();
+			this->initContext();
+			return;
+		}
+
+		SharedContext.release();
+	}
+
+	if(Headless)
+	{
+#		if defined(_DEBUG)
+			bool const Debug = true;
+#		else
+			bool const Debug = false;
+#		endif
+		this->Headless.reset(new headless(WindowSize, Profile == ES, this->Major, this->Minor, Profile == CORE, Debug));
+		if(this->Headless->isValid())
+		{
+			glewExperimental = GL_TRUE;
+			glewInit();
+			glGetError();
+			this->initContext();
+		}
+		return;
+	}
 
 	glfwInit();
 	glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
@@ -196,34 +341,140 @@ test::test
 	if(this->Window)
 	{
 		glfwSetWindowPos(this->Window, 64, 64);
-		glfwSetWindowUserPointer(this->Window, this);
-		glfwSetMouseButtonCallback(this->Window, test::mouseButtonCallback);
-		glfwSetCursorPosCallback(this->Window, test::cursorPositionCallback);
-		glfwSetKeyCallback(this->Window, test::keyCallback);
-		glfwMakeContextCurrent(this->Window);
+		this->initWindow();
 
 		glewExperimental = GL_TRUE;
 		glewInit();
 		glGetError();
 
-#		if defined(GL_KHR_debug)
-			if(this->isExtensionSupported("GL_KHR_debug"))
-			{
-				glEnable(GL_DEBUG_OUTPUT);
-				glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-				glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
-				glDebugMessageCallback(&test::debugOutput, this);
-			}
-#		endif
+		this->initContext();
+	}
+}
+
+void test::initWindow()
+{
+	glfwSetWindowUserPointer(this->Window, this);
+	glfwSetMouseButtonCallback(this->Window, test::mouseButtonCallback);
+	glfwSetCursorPosCallback(this->Window, test::cursorPositionCallback);
+	glfwSetKeyCallback(this->Window, test::keyCallback);
+	glfwMakeContextCurrent(this->Window);
+}
+
+void test::initContext()
+{
+#	if defined(GL_KHR_debug)
+		if(this->isExtensionSupported("GL_KHR_debug"))
+		{
+			glEnable(GL_DEBUG_OUTPUT);
+			glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+			glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+			glDebugMessageCallback(&test::debugOutput, this);
+		}
+#	endif
+
+	// glewInit reloads the function pointers of the context, patch them again
+	if(this->CountCalls)
+		intercept::install();
+
+	glGenQueries(static_cast<GLsizei>(this->TimerQueryName.size()), &this->TimerQueryName[0]);
+
+	this->TimestampSupported = this->Profile != ES &&
+		(version(this->Major, this->Minor) >= version(3, 3) || this->isExtensionSupported("GL_ARB_timer_query"));
+	if(this->TimestampSupported)
+		glGenQueries(static_cast<GLsizei>(this->TimestampQueryName.size()), &this->TimestampQueryName[0]);
+}
 
-		glGenQueries(1, &this->TimerQueryName);
+// Restore the default state so that a test running in a shared context doesn't inherit the previous test state
+void test::resetState()
+{
+	bool const HasVertexArray = version(this->Major, this->Minor) >= version(3, 0);
+
+	glGetError();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glUseProgram(0);
+	if(glBindProgramPipeline)
+		glBindProgramPipeline(0);
+	if(HasVertexArray)
+	{
+		glBindVertexArray(0);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 	}
+	if(version(this->Major, this->Minor) >= version(4, 0) && this->Profile != ES)
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glActiveTexture(GL_TEXTURE0);
+
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_STENCIL_TEST);
+	glDisable(GL_BLEND);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_SCISSOR_TEST);
+	glDepthFunc(GL_LESS);
+	glDepthMask(GL_TRUE);
+	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+	glm::uvec2 const WindowSize(this->getWindowSize());
+	glViewport(0, 0, static_cast<GLsizei>(WindowSize.x), static_cast<GLsizei>(WindowSize.y));
+
+	this->State.invalidate();
+
+	// Don't let the previous test GPU work leak into this test first frames
+	glFinish();
+	glGetError();
+}
+
+void test::beginSharedContext()
+{
+	SharedContext.Enabled = true;
+}
+
+void test::endSharedContext()
+{
+	SharedContext.Enabled = false;
+	SharedContext.release();
+	glfwTerminate();
 }
 
 test::~test()
 {
-	if(this->TimerQueryName)
-		glDeleteQueries(1, &this->TimerQueryName);
+	// The screenshots of the failed checks are written in the background, the test is done once they are on disk
+	flush_png();
+
+	if(this->TimerQueryName[0])
+		glDeleteQueries(static_cast<GLsizei>(this->TimerQueryName.size()), &this->TimerQueryName[0]);
+	if(this->TimestampQueryName[0])
+		glDeleteQueries(static_cast<GLsizei>(this->TimestampQueryName.size()), &this->TimestampQueryName[0]);
+
+	if(SharedContext.Enabled && (this->Window || (this->Headless && this->Headless->isValid())))
+	{
+		// The next test makes GL calls before registering itself, no message may reach this destroyed test
+#		if defined(GL_KHR_debug)
+			if(this->isExtensionSupported("GL_KHR_debug"))
+				glDebugMessageCallback(nullptr, nullptr);
+#		endif
+
+		SharedContext.Profile = this->Profile;
+		SharedContext.Major = this->Major;
+		SharedContext.Minor = this->Minor;
+		SharedContext.Size = this->getWindowSize();
+		SharedContext.Window = this->Window;
+		SharedContext.Headless = std::move(this->Headless);
+		SharedContext.Caps = std::move(this->Caps);
+		SharedContext.Extensions = std::move(this->Extensions);
+		this->Window = nullptr;
+		return;
+	}
+
+	if(this->Headless)
+	{
+		this->Headless.reset();
+		return;
+	}
 
 	if(this->Window)
 	{
@@ -236,7 +487,7 @@ test::~test()
 
 int test::operator()()
 {
-	if(this->Window == 0)
+	if(this->Headless ? !this->Headless->isValid() : this->Window == 0)
 		return EXIT_FAILURE;
 
 	int Result = EXIT_SUCCESS;
@@ -248,36 +499,98 @@ int test::operator()()
 	if(Result == EXIT_SUCCESS)
 		Result = this->begin() ? EXIT_SUCCESS : EXIT_FAILURE;
 
+	if(Result == EXIT_SUCCESS && this->Skipped)
+		return this->end() && !this->Error ? EXIT_SUCCESS : EXIT_FAILURE;
+
 	std::size_t FrameNum = 0;
 	bool Automated = false;
 #	ifdef AUTOMATED_TESTS
 		Automated = true;
-		FrameNum = this->FrameCount;
 #	endif//AUTOMATED_TESTS
 
+	// Without a window nobody can close the sample so headless runs are always automated
+	if(this->Headless)
+		Automated = true;
+	if(Automated)
+		FrameNum = this->FrameCount;
+
+	this->calibrateTimestamp();
+
 	while(Result == EXIT_SUCCESS && !this->Error)
 	{
+		this->FrameDrawCount = 0;
+		this->FrameDispatchCount = 0;
+		this->FrameUploadSize = 0;
+		this->FrameTexelCount = 0;
+
+		if(this->CountCalls)
+			intercept::reset();
+		this->State.resetStats();
+
+		this->beginTimestamp();
+		cpuClock::time_point const RenderBegin = cpuClock::now();
 		Result = this->render() ? EXIT_SUCCESS : EXIT_FAILURE;
+		cpuClock::time_point const RenderEnd = cpuClock::now();
+		this->endTimestamp();
+
+		if(this->CountCalls)
+		{
+			intercept::counters const & Counters = intercept::get();
+			this->DrawCallSamples.push_back(static_cast<double>(Counters.Draws));
+			this->BindSamples.push_back(static_cast<double>(Counters.Binds));
+			this->UniformSamples.push_back(static_cast<double>(Counters.Uniforms));
+			this->StateSamples.push_back(static_cast<double>(Counters.States));
+			this->UploadSamples.push_back(static_cast<double>(Counters.Uploads));
+			this->UploadedByteSamples.push_back(static_cast<double>(Counters.UploadedBytes));
+		}
+
+		gl::state::stats const & StateStats = this->State.getStats();
+		if(StateStats.Forwarded + StateStats.Filtered > 0)
+			this->FilteredSamples.push_back(static_cast<double>(StateStats.Filtered));
+
+		double const RenderTime = elapsedMicroseconds(RenderBegin, RenderEnd);
+		this->RenderSamples.push_back(RenderTime);
+		if(this->CPUTimeSamples)
+			this->addTimeSample(RenderTime);
+		if(this->FrameDrawCount > 0 && RenderTime > 0.0)
+			this->DrawRateSamples.push_back(static_cast<double>(this->FrameDrawCount) * 1000000.0 / RenderTime);
+		if(this->FrameDispatchCount > 0 && RenderTime > 0.0)
+			this->DispatchRateSamples.push_back(static_cast<double>(this->FrameDispatchCount) * 1000000.0 / RenderTime);
+		// Bytes per microsecond are MB per second
+		if(this->FrameUploadSize > 0 && RenderTime > 0.0)
+			this->UploadRateSamples.push_back(static_cast<double>(this->FrameUploadSize) / RenderTime);
+		if(this->FrameTexelCount > 0 && RenderTime > 0.0)
+			this->TexelRateSamples.push_back(static_cast<double>(this->FrameTexelCount) * 1000000.0 / RenderTime);
+
 		Result = Result && this->checkError("render");
 
-		glfwPollEvents();
-		if(glfwWindowShouldClose(this->Window) || (Automated && FrameNum == 0))
+		if(!this->Headless)
+		{
+			cpuClock::time_point const PollBegin = cpuClock::now();
+			glfwPollEvents();
+			this->PollSamples.push_back(elapsedMicroseconds(PollBegin, cpuClock::now()));
+		}
+		if(this->shouldClose() || (Automated && FrameNum == 0))
 		{
 			if(this->Success == MATCH_TEMPLATE)
 			{
-				if(!checkTemplate(this->Window, this->Title.c_str()))
+				if(!checkTemplate(this->Title.c_str()))
 					Result = EXIT_FAILURE;
 				this->checkError("checkTemplate");
 			}
 			break;
 		}
 
+		cpuClock::time_point const SwapBegin = cpuClock::now();
 		this->swap();
+		this->SwapSamples.push_back(elapsedMicroseconds(SwapBegin, cpuClock::now()));
 
 		if(Automated)
 			--FrameNum;
 	}
 
+	this->flushTimer();
+
 	Result = this->end() && (Result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
 
 	if(this->Success == GENERATE_ERROR)
@@ -288,50 +601,124 @@ int test::operator()()
 
 void test::swap()
 {
-	glfwSwapBuffers(this->Window);
+	if(this->Headless)
+		this->Headless->swap();
+	else
+		glfwSwapBuffers(this->Window);
 }
 
 void test::sync(sync_mode const & Sync)
 {
+	int Interval = 0;
 	switch(Sync)
 	{
 	case ASYNC:
-		glfwSwapInterval(0);
+		Interval = 0;
 		break;
 	case VSYNC:
-		glfwSwapInterval(1);
+		Interval = 1;
 		break;
 	case TEARING:
-		glfwSwapInterval(-1);
+		Interval = -1;
 		break;
 	default:
 		assert(0);
 	}
+
+	if(this->Headless)
+		this->Headless->sync(Interval);
+	else
+		glfwSwapInterval(Interval);
 }
 
 void test::stop()
 {
-	glfwSetWindowShouldClose(this->Window, GL_TRUE);
+	if(this->Headless)
+		this->Stop = true;
+	else
+		glfwSetWindowShouldClose(this->Window, GL_TRUE);
+}
+
+bool test::shouldClose() const
+{
+	if(this->Headless)
+		return this->Stop;
+	return glfwWindowShouldClose(this->Window) != 0;
 }
 
 void test::log(csv & CSV, char const * String)
 {
-	CSV.log(String, this->TimeSum / this->FrameCount, this->TimeMin, this->TimeMax);
+	char const* Renderer = reinterpret_cast<char const*>(glGetString(GL_RENDERER));
+	char const* Version = reinterpret_cast<char const*>(glGetString(GL_VERSION));
+
+	std::string const RendererString(Renderer ? Renderer : "");
+	std::string const VersionString(Version ? Version : "");
+
+	if(this->Skipped)
+	{
+		CSV.log(format("%s (skipped)", String).c_str(), std::vector<double>(), RendererString, VersionString);
+		return;
+	}
+
+	CSV.log(String, this->TimeSamples, RendererString, VersionString);
+
+	struct frameSamples
+	{
+		char const * Label;
+		std::vector<double> const & Samples;
+		bool Time;
+	} const FrameSamples[] =
+	{
+		{"cpu render", this->RenderSamples, true},
+		{"cpu swap", this->SwapSamples, true},
+		{"cpu poll", this->PollSamples, true},
+		{"gpu frame", this->GPUFrameSamples, true},
+		{"latency", this->LatencySamples, true},
+		{"draws per cpu second", this->DrawRateSamples, false},
+		{"dispatches per cpu second", this->DispatchRateSamples, false},
+		{"MB per cpu second", this->UploadRateSamples, false},
+		{"texels per cpu second", this->TexelRateSamples, false},
+		{"draw calls", this->DrawCallSamples, false},
+		{"binds", this->BindSamples, false},
+		{"uniform updates", this->UniformSamples, false},
+		{"state changes", this->StateSamples, false},
+		{"buffer uploads", this->UploadSamples, false},
+		{"uploaded bytes", this->UploadedByteSamples, false},
+		{"filtered calls", this->FilteredSamples, false}
+	};
+
+	for(std::size_t i = 0; i < sizeof(FrameSamples) / sizeof(FrameSamples[0]); ++i)
+		if(!FrameSamples[i].Samples.empty())
+			CSV.log(format("%s (%s)", String, FrameSamples[i].Label).c_str(), FrameSamples[i].Samples, RendererString, VersionString, FrameSamples[i].Time);
+
+	for(std::size_t i = 0; i < this->Rows.size(); ++i)
+		CSV.log(format("%s (%s)", String, this->Rows[i].Label.c_str()).c_str(), this->Rows[i].Samples, RendererString, VersionString, this->Rows[i].Time);
 }
 
-bool test::isExtensionSupported(char const * String)
+bool test::isExtensionSupported(char const * String) const
 {
-	GLint ExtensionCount(0);
-	glGetIntegerv(GL_NUM_EXTENSIONS, &ExtensionCount);
-	for(GLint i = 0; i < ExtensionCount; ++i)
-		if(std::string((char const*)glGetStringi(GL_EXTENSIONS, i)) == std::string(String))
-			return true;
-	//printf("Failed to find Extension: \"%s\"\n",String);
-	return false;
+	if(!this->Extensions)
+		this->Extensions.reset(new extensionSet(this->Profile == CORE));
+
+	return this->Extensions->isSupported(String);
+}
+
+caps const & test::getCaps() const
+{
+	if(!this->Caps)
+	{
+		caps::profile const Profile = this->Profile == ES ? caps::ES : this->Profile == COMPATIBILITY ? caps::COMPATIBILITY : caps::CORE;
+		this->Caps.reset(new caps(Profile));
+	}
+
+	return *this->Caps;
 }
 
 glm::uvec2 test::getWindowSize() const
 {
+	if(this->Headless)
+		return this->Headless->getSize();
+
 	glm::ivec2 WindowSize(0);
 	glfwGetFramebufferSize(this->Window, &WindowSize.x, &WindowSize.y);
 	return glm::uvec2(WindowSize);
@@ -355,82 +742,256 @@ glm::vec3 test::cameraPosition() const
 	return glm::vec3(0.0f, 0.0f, -this->TranlationCurrent.y);
 }
 
-bool test::checkTemplate(GLFWwindow* pWindow, char const * Title)
+bool test::checkTemplate(char const * Title)
 {
+	gli::texture2D Template(loadTemplate(getDataDirectory() + "templates/" + ::vendor() + Title + ".png"));
+
 	GLint ColorType = GL_UNSIGNED_BYTE;
-	GLint ColorFormat = GL_RGBA;
-		
+	GLint ColorFormat = Template.format() == gli::FORMAT_RGB8_UNORM ? GL_RGB : GL_RGBA;
+
 	if (Profile == ES)
 	{
 		glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_TYPE, &ColorType);
 		glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &ColorFormat);
 	}
 
-	GLint WindowSizeX(0);
-	GLint WindowSizeY(0);
-	glfwGetFramebufferSize(pWindow, &WindowSizeX, &WindowSizeY);
+	glm::uvec2 const WindowSize(this->getWindowSize());
+	GLint const WindowSizeX(static_cast<GLint>(WindowSize.x));
+	GLint const WindowSizeY(static_cast<GLint>(WindowSize.y));
 
+	// Read back in the template layout when possible so that the driver strips alpha
 	gli::texture2D TextureRead(1, ColorFormat == GL_RGBA ? gli::FORMAT_RGBA8_UNORM : gli::FORMAT_RGB8_UNORM, gli::texture2D::dim_type(WindowSizeX, WindowSizeY));
 
+	GLint PackAlignment(4);
+	glGetIntegerv(GL_PACK_ALIGNMENT, &PackAlignment);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	glReadPixels(0, 0, WindowSizeX, WindowSizeY, ColorFormat, ColorType, TextureRead.data());
 
-	gli::texture2D TextureRGB(1, gli::FORMAT_RGB8_UNORM, gli::texture2D::dim_type(WindowSizeX, WindowSizeY));
+	glPixelStorei(GL_PACK_ALIGNMENT, PackAlignment);
 
-	if(TextureRead.format() == gli::FORMAT_RGBA8_UNORM)
-	{
-		for(gli::size_t y = 0; y < TextureRGB.dimensions().y; ++y)
-		for(gli::size_t x = 0; x < TextureRGB.dimensions().x; ++x)
-		{
-			gli::texture2D::dim_type TexelCoord(x, y);
+	bool Success = true;
 
-			glm::u8vec3 Color(gli::texelFetch<glm::u8vec4>(TextureRead, TexelCoord, 0));
-			gli::texelWrite(TextureRGB, TexelCoord, 0, Color);
-		}
-	}
-	else
-	{
-		TextureRGB[0] = TextureRead[0];
-	}
+	if(Success)
+		Success = Success && (!Template.empty());
 
-	bool Success = true;
+	if(Success)
+		Success = Success && (Template.dimensions() == TextureRead.dimensions());
 
 	if(Success)
 	{
-		gli::texture2D Template(load_png((getDataDirectory() + "templates/" + ::vendor() + Title + ".png").c_str()));
+		compare_result const Result = compare_rgb(TextureRead, Template, this->TemplateTolerance);
+		Success = Success && (Result.ErrorCount <= this->TemplateMaxErrorCount);
 
-		if(Success)
-			Success = Success && (!Template.empty());
-
-		if(Success)
-			Success = Success && (Template == TextureRGB);
+		if(Result.ErrorCount > 0)
+			fprintf(stdout, "%s: %d pixels differ from the template, PSNR %2.2f dB\n", Title, static_cast<int>(Result.ErrorCount), Result.PSNR);
 	}
 
 	if(!Success)
-		save_png(TextureRGB, (getBinaryDirectory() + Title + ".png").c_str());
+	{
+		gli::texture2D TextureRGB(1, gli::FORMAT_RGB8_UNORM, gli::texture2D::dim_type(WindowSizeX, WindowSizeY));
+
+		if(TextureRead.format() == gli::FORMAT_RGBA8_UNORM)
+		{
+			glm::u8vec4 const * Src = TextureRead.data<glm::u8vec4>();
+			glm::u8vec3 * Dst = TextureRGB.data<glm::u8vec3>();
+			for(std::size_t TexelIndex = 0, TexelCount = TextureRGB.size() / sizeof(glm::u8vec3); TexelIndex < TexelCount; ++TexelIndex)
+				Dst[TexelIndex] = glm::u8vec3(Src[TexelIndex]);
+		}
+		else
+		{
+			TextureRGB[0] = TextureRead[0];
+		}
+
+		save_png_async(TextureRGB, (getBinaryDirectory() + Title + ".png").c_str());
+	}
 
 	return Success;
 }
 
+void test::setTemplateTolerance(glm::u8vec3 const & Tolerance, std::size_t MaxErrorCount)
+{
+	this->TemplateTolerance = Tolerance;
+	this->TemplateMaxErrorCount = MaxErrorCount;
+}
+
 void test::beginTimer()
 {
-	glBeginQuery(GL_TIME_ELAPSED, this->TimerQueryName);
+	// All the queries are still in flight: wait for the oldest one to reuse it
+	if(this->TimerQueryPending == this->TimerQueryName.size())
+		this->resolveTimer(true);
+
+	std::size_t const Index = (this->TimerQueryFirst + this->TimerQueryPending) % this->TimerQueryName.size();
+	this->TimerQueryFrame[Index] = this->TimerFrame;
+
+	glBeginQuery(GL_TIME_ELAPSED, this->TimerQueryName[Index]);
 }
 
 void test::endTimer()
 {
 	glEndQuery(GL_TIME_ELAPSED);
 
-	GLuint QueryTime(0);
-	glGetQueryObjectuiv(this->TimerQueryName, GL_QUERY_RESULT, &QueryTime);
+	++this->TimerQueryPending;
+	++this->TimerFrame;
+
+	// Collect the results already available without waiting on the GPU
+	while(this->TimerQueryPending > 0 && this->resolveTimer(false)){}
+}
+
+void test::flushTimer()
+{
+	while(this->TimerQueryPending > 0)
+		this->resolveTimer(true);
+	while(this->TimestampQueryPending > 0)
+		this->resolveTimestamp(true);
+}
+
+bool test::resolveTimer(bool Wait)
+{
+	assert(this->TimerQueryPending > 0);
+
+	GLuint const QueryName = this->TimerQueryName[this->TimerQueryFirst];
+
+	if(!Wait)
+	{
+		GLuint Available(GL_FALSE);
+		glGetQueryObjectuiv(QueryName, GL_QUERY_RESULT_AVAILABLE, &Available);
+		if(Available == GL_FALSE)
+			return false;
+	}
+
+	GLuint64 QueryTime(0);
+	glGetQueryObjectui64v(QueryName, GL_QUERY_RESULT, &QueryTime);
+
+	this->recordTime(this->TimerQueryFrame[this->TimerQueryFirst], static_cast<double>(QueryTime) / 1000.0);
+
+	this->TimerQueryFirst = (this->TimerQueryFirst + 1) % this->TimerQueryName.size();
+	--this->TimerQueryPending;
+
+	return true;
+}
+
+// Both clocks are read back to back, the offset converts CPU times into the GPU timestamp domain
+void test::calibrateTimestamp()
+{
+	if(!this->TimestampSupported)
+		return;
+
+	GLint64 GPUTime(0);
+	glGetInteger64v(GL_TIMESTAMP, &GPUTime);
+	this->TimestampOffset = GPUTime - cpuNanoseconds();
+}
+
+void test::beginTimestamp()
+{
+	if(!this->TimestampSupported)
+		return;
 
-	double const InstantTime(static_cast<double>(QueryTime) / 1000.0);
+	if(this->TimestampQueryPending == this->TimestampSubmit.size())
+		this->resolveTimestamp(true);
 
-	this->TimeSum += InstantTime;
-	this->TimeMax = glm::max(this->TimeMax, InstantTime);
-	this->TimeMin = glm::min(this->TimeMin, InstantTime);
+	std::size_t const Index = (this->TimestampQueryFirst + this->TimestampQueryPending) % this->TimestampSubmit.size();
+	this->TimestampSubmit[Index] = cpuNanoseconds() + this->TimestampOffset;
 
-	fprintf(stdout, "\rTime: %2.4f ms    ", InstantTime / 1000.0);
+	glQueryCounter(this->TimestampQueryName[Index * 2 + 0], GL_TIMESTAMP);
+}
+
+void test::endTimestamp()
+{
+	if(!this->TimestampSupported)
+		return;
+
+	std::size_t const Index = (this->TimestampQueryFirst + this->TimestampQueryPending) % this->TimestampSubmit.size();
+	glQueryCounter(this->TimestampQueryName[Index * 2 + 1], GL_TIMESTAMP);
+
+	++this->TimestampQueryPending;
+
+	while(this->TimestampQueryPending > 0 && this->resolveTimestamp(false)){}
+}
+
+bool test::resolveTimestamp(bool Wait)
+{
+	assert(this->TimestampQueryPending > 0);
+
+	std::size_t const Index = this->TimestampQueryFirst;
+
+	// Timestamps complete in order, the end of the frame being available implies its beginning is
+	if(!Wait)
+	{
+		GLuint Available(GL_FALSE);
+		glGetQueryObjectuiv(this->TimestampQueryName[Index * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &Available);
+		if(Available == GL_FALSE)
+			return false;
+	}
+
+	GLuint64 Begin(0);
+	GLuint64 End(0);
+	glGetQueryObjectui64v(this->TimestampQueryName[Index * 2 + 0], GL_QUERY_RESULT, &Begin);
+	glGetQueryObjectui64v(this->TimestampQueryName[Index * 2 + 1], GL_QUERY_RESULT, &End);
+
+	this->GPUFrameSamples.push_back(static_cast<double>(End - Begin) / 1000.0);
+	this->LatencySamples.push_back(static_cast<double>(static_cast<GLint64>(Begin) - this->TimestampSubmit[Index]) / 1000.0);
+
+	this->TimestampQueryFirst = (this->TimestampQueryFirst + 1) % this->TimestampSubmit.size();
+	--this->TimestampQueryPending;
+
+	return true;
+}
+
+void test::addDrawCount(std::size_t Count)
+{
+	this->FrameDrawCount += Count;
+}
+
+void test::addDispatchCount(std::size_t Count)
+{
+	this->FrameDispatchCount += Count;
+}
+
+void test::addUploadSize(std::size_t Size)
+{
+	this->FrameUploadSize += Size;
+}
+
+void test::addTexelCount(std::size_t Count)
+{
+	this->FrameTexelCount += Count;
+}
+
+intercept::counters const & test::getCallCounters() const
+{
+	return intercept::get();
+}
+
+void test::addSample(char const * Label, double Sample, bool Time)
+{
+	for(std::size_t i = 0; i < this->Rows.size(); ++i)
+	{
+		if(this->Rows[i].Label != Label)
+			continue;
+
+		this->Rows[i].Samples.push_back(Sample);
+		return;
+	}
+
+	row Row;
+	Row.Label = Label;
+	Row.Samples.push_back(Sample);
+	Row.Time = Time;
+	this->Rows.push_back(Row);
+}
+
+void test::addTimeSample(double Time)
+{
+	this->recordTime(this->TimerFrame++, Time);
+}
+
+void test::recordTime(std::size_t Frame, double Time)
+{
+	this->TimeSamples.push_back(Time);
+
+	fprintf(stdout, "\rFrame %d: %2.4f ms    ", static_cast<int>(Frame), Time / 1000.0);
 }
 
 std::string test::loadFile(std::string const & Filename) const
@@ -560,15 +1121,18 @@ bool test::checkFramebuffer(GLuint FramebufferName) const
 
 bool test::checkExtension(char const * ExtensionName) const
 {
-	GLint ExtensionCount = 0;
-	glGetIntegerv(GL_NUM_EXTENSIONS, &ExtensionCount);
-	for(GLint i = 0; i < ExtensionCount; ++i)
-		if(std::string((char const*)glGetStringi(GL_EXTENSIONS, i)) == std::string(ExtensionName))
-			return true;
+	if(this->isExtensionSupported(ExtensionName))
+		return true;
 	printf("Failed to find Extension: \"%s\"\n", ExtensionName);
 	return false;
 }
 
+void test::skip(char const * Reason)
+{
+	printf("Skipped: %s\n", Reason);
+	this->Skipped = true;
+}
+
 bool test::checkGLVersion(GLint MajorVersionRequire, GLint MinorVersionRequire) const
 {
 	GLint MajorVersionContext = 0;
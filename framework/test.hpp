@@ -31,8 +31,11 @@
 #include "sementics.hpp"
 #include "vertex.hpp"
 #include "buffer.hpp"
+#include "state.hpp"
 #include "caps.hpp"
 #include "util.hpp"
+#include "headless.hpp"
+#include "intercept.hpp"
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -133,6 +136,9 @@ inline bool operator!= (vertexattrib const & A, vertexattrib const & B)
 	return !(A == B);
 }
 
+struct caps;
+class extensionSet;
+
 std::string getDataDirectory();
 std::string getBinaryDirectory();
 
@@ -165,6 +171,10 @@ public:
 	int operator()();
 	void log(csv & CSV, char const * String);
 
+	// Between these calls, tests with the same profile, version and window size reuse the window and context of the previous test
+	static void beginSharedContext();
+	static void endSharedContext();
+
 protected:
 	struct DrawArraysIndirectCommand
 	{
@@ -269,17 +279,41 @@ protected:
 	void sync(sync_mode const & Sync);
 	void stop();
 
-	bool isExtensionSupported(char const * String);
+	// Only queries the extension strings, without building the caps
+	bool isExtensionSupported(char const * String) const;
+	// Capabilities of the context, queried on first use and kept with the context when it is shared
+	caps const & getCaps() const;
 	glm::uvec2 getWindowSize() const;
 	bool isKeyPressed(int Key) const;
 	glm::mat4 view() const;
 	float cameraDistance() const {return this->TranlationCurrent.y;}
 	glm::vec3 cameraPosition() const;
-	bool checkTemplate(GLFWwindow* pWindow, char const * Title);
+	bool checkTemplate(char const * Title);
+	bool isHeadless() const{return this->Headless != nullptr;}
 
 protected:
 	void beginTimer();
 	void endTimer();
+	// Wait for all the pending timer queries
+	void flushTimer();
+	// Record a duration in microseconds measured by the test instead of the GPU timer
+	void addTimeSample(double Time);
+	// For tests without GPU work or measuring the submission cost: the main time row reports the CPU render time measured by the run loop
+	void setCPUTimeSamples(bool Enable){this->CPUTimeSamples = Enable;}
+	// Sample of an additional row logged as "<test> (<Label>)", a duration in microseconds when Time is true
+	void addSample(char const * Label, double Sample, bool Time = true);
+	// Number of draws submitted by the current frame, used to report draws per second of CPU render time
+	void addDrawCount(std::size_t Count);
+	// Number of compute dispatches submitted by the current frame, reported like the draws
+	void addDispatchCount(std::size_t Count);
+	// Number of bytes the current frame streams to GL, used to report the bandwidth over the CPU render time
+	void addUploadSize(std::size_t Size);
+	// Number of texels the current frame uploads, used to report texels per second of CPU render time
+	void addTexelCount(std::size_t Count);
+	// GL calls counted during the current frame render, only when the interception layer is requested
+	intercept::counters const & getCallCounters() const;
+	// Binding and enable calls going through this cache skip the driver when they don't change the state
+	gl::state & getState(){return this->State;}
 
 	std::string loadFile(std::string const & Filename) const;
 	void logImplementationDependentLimit(GLenum Value, std::string const & String) const;
@@ -287,16 +321,51 @@ protected:
 	bool checkError(const char* Title) const;
 	bool checkFramebuffer(GLuint FramebufferName) const;
 	bool checkExtension(char const * ExtensionName) const;
+	// Called by begin() when the context lacks an optional requirement: the test ends successfully without rendering
+	void skip(char const * Reason);
+	// Accept template mismatches up to Tolerance per channel on at most MaxErrorCount pixels
+	void setTemplateTolerance(glm::u8vec3 const & Tolerance, std::size_t MaxErrorCount);
 
 private:
 	GLFWwindow* Window;
+	std::unique_ptr<headless> Headless;
+	mutable std::unique_ptr<caps> Caps;
+	mutable std::unique_ptr<extensionSet> Extensions;
+	gl::state State;
 	success const Success;
 	std::string const Title;
 	profile const Profile;
 	int const Major;
 	int const Minor;
-	GLuint TimerQueryName;
+	// Ring of GL_TIME_ELAPSED queries read back a few frames late to avoid stalling the pipeline
+	enum
+	{
+		TIMER_QUERY_COUNT = 8
+	};
+	std::array<GLuint, TIMER_QUERY_COUNT> TimerQueryName;
+	std::array<std::size_t, TIMER_QUERY_COUNT> TimerQueryFrame;
+	std::size_t TimerQueryFirst;
+	std::size_t TimerQueryPending;
+	std::size_t TimerFrame;
+	// Ring of GL_TIMESTAMP query pairs bracketing the commands of each frame
+	std::array<GLuint, TIMER_QUERY_COUNT * 2> TimestampQueryName;
+	// CPU time in nanoseconds when the frame first command was issued, converted to the GPU clock
+	std::array<GLint64, TIMER_QUERY_COUNT> TimestampSubmit;
+	std::size_t TimestampQueryFirst;
+	std::size_t TimestampQueryPending;
+	// GPU clock minus CPU clock in nanoseconds, measured when the test starts
+	GLint64 TimestampOffset;
+	bool TimestampSupported;
+	std::size_t FrameDrawCount;
+	std::size_t FrameDispatchCount;
+	std::size_t FrameUploadSize;
+	std::size_t FrameTexelCount;
+	bool CPUTimeSamples;
+	bool Skipped;
+	bool const CountCalls;
 	std::size_t const FrameCount;
+	glm::u8vec3 TemplateTolerance;
+	std::size_t TemplateMaxErrorCount;
 	glm::vec2 MouseOrigin;
 	glm::vec2 MouseCurrent;
 	glm::vec2 TranlationOrigin;
@@ -305,13 +374,52 @@ private:
 	glm::vec2 RotationCurrent;
 	int MouseButtonFlags;
 	std::array<bool, 512> KeyPressed;
+	bool Stop;
 	bool Error;
 
 private:
-	double TimeSum, TimeMin, TimeMax;
+	std::vector<double> TimeSamples;
+	// Per frame CPU durations in microseconds of render(), swap() and glfwPollEvents()
+	std::vector<double> RenderSamples;
+	std::vector<double> SwapSamples;
+	std::vector<double> PollSamples;
+	// Per frame GPU duration and latency between the CPU submission and the GPU execution in microseconds
+	std::vector<double> GPUFrameSamples;
+	std::vector<double> LatencySamples;
+	std::vector<double> DrawRateSamples;
+	std::vector<double> DispatchRateSamples;
+	std::vector<double> UploadRateSamples;
+	std::vector<double> TexelRateSamples;
+	// Per frame GL calls counted by the interception layer
+	std::vector<double> DrawCallSamples;
+	std::vector<double> BindSamples;
+	std::vector<double> UniformSamples;
+	std::vector<double> StateSamples;
+	std::vector<double> UploadSamples;
+	std::vector<double> UploadedByteSamples;
+	// Per frame calls dropped by the state cache
+	std::vector<double> FilteredSamples;
+	// Rows added by the test
+	struct row
+	{
+		std::string Label;
+		std::vector<double> Samples;
+		bool Time;
+	};
+	std::vector<row> Rows;
 
 private:
 	int version(int Major, int Minor) const{return Major * 100 + Minor * 10;}
+	void initWindow();
+	void initContext();
+	void resetState();
+	bool resolveTimer(bool Wait);
+	void calibrateTimestamp();
+	void beginTimestamp();
+	void endTimestamp();
+	bool resolveTimestamp(bool Wait);
+	void recordTime(std::size_t Frame, double Time);
+	bool shouldClose() const;
 	bool checkGLVersion(GLint MajorVersionRequire, GLint MinorVersionRequire) const;
 
 	static void cursorPositionCallback(GLFWwindow* Window, double x, double y);
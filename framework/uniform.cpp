@@ -0,0 +1,74 @@
+#include "uniform.hpp"
+#include <cassert>
+
+namespace
+{
+	std::size_t uniformAlignment()
+	{
+		GLint Alignment(0);
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &Alignment);
+		return Alignment > 0 ? static_cast<std::size_t>(Alignment) : 256;
+	}
+}//namespace
+
+namespace gl
+{
+	uniform_arena::uniform_arena(std::size_t Size, bool MultiBind) :
+		Ring(Size, uniformAlignment(), buffer::COHERENT_BIT),
+		Alignment(uniformAlignment()),
+		MultiBind(MultiBind && (GLEW_VERSION_4_4 || GLEW_ARB_multi_bind)),
+		Dirty(0)
+	{
+		this->Buffers.fill(this->Ring.name());
+		this->Offsets.fill(0);
+		// A range can't be empty, bindings never set in a multi bind range are bound to the first block of the ring
+		this->Sizes.fill(static_cast<GLsizeiptr>(this->Alignment));
+	}
+
+	void* uniform_arena::allocate(GLuint Binding, std::size_t Size)
+	{
+		assert(Binding < BINDING_MAX);
+
+		ring::allocation const Allocation = this->Ring.allocate(Size);
+		if(!Allocation.Pointer)
+			return nullptr;
+
+		this->Offsets[Binding] = static_cast<GLintptr>(Allocation.Offset);
+		this->Sizes[Binding] = static_cast<GLsizeiptr>(Allocation.Size);
+		this->Dirty |= 1 << Binding;
+
+		return Allocation.Pointer;
+	}
+
+	void uniform_arena::bind()
+	{
+		if(!this->Dirty)
+			return;
+
+		if(this->MultiBind)
+		{
+			// A single call covers the span of the updated bindings, the bindings in between are rebound to their current range
+			GLuint First = 0;
+			while(!(this->Dirty & (1 << First)))
+				++First;
+			GLuint Last = BINDING_MAX - 1;
+			while(!(this->Dirty & (1 << Last)))
+				--Last;
+
+			glBindBuffersRange(GL_UNIFORM_BUFFER, First, Last - First + 1, &this->Buffers[First], &this->Offsets[First], &this->Sizes[First]);
+		}
+		else
+		{
+			for(GLuint Binding = 0; Binding < BINDING_MAX; ++Binding)
+				if(this->Dirty & (1 << Binding))
+					glBindBufferRange(GL_UNIFORM_BUFFER, Binding, this->Buffers[Binding], this->Offsets[Binding], this->Sizes[Binding]);
+		}
+
+		this->Dirty = 0;
+	}
+
+	void uniform_arena::fence()
+	{
+		this->Ring.fence();
+	}
+}//namespace gl
@@ -0,0 +1,55 @@
+#ifndef UNIFORM_INCLUDED
+#define UNIFORM_INCLUDED
+
+#include "buffer.hpp"
+#include <array>
+
+namespace gl
+{
+	// Per draw uniform blocks packed at GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT in a gl::ring, written through its
+	// persistent mapping. bind() binds the blocks set for the next draw with a single glBindBuffersRange
+	// when ARB_multi_bind is available, with one glBindBufferRange per updated binding otherwise.
+	class uniform_arena : noncopyable
+	{
+	public:
+		enum
+		{
+			BINDING_MAX = 8
+		};
+
+		// Size is the memory of the frames in flight, MultiBind = false forces the glBindBufferRange path
+		explicit uniform_arena(std::size_t Size, bool MultiBind = true);
+
+		bool isValid() const{return this->Ring.isValid();}
+		std::size_t alignment() const{return this->Alignment;}
+		bool isMultiBind() const{return this->MultiBind;}
+
+		// Returns the memory of the block bound at Binding for the next draw, null when the arena is full
+		void* allocate(GLuint Binding, std::size_t Size);
+		template <typename genType>
+		genType* allocate(GLuint Binding){return static_cast<genType*>(this->allocate(Binding, sizeof(genType)));}
+		template <typename genType>
+		void set(GLuint Binding, genType const & Block)
+		{
+			if(genType* Pointer = this->allocate<genType>(Binding))
+				*Pointer = Block;
+		}
+
+		// Bind the blocks set since the previous call
+		void bind();
+		// Call once per frame after the last draw
+		void fence();
+
+	private:
+		ring Ring;
+		std::size_t const Alignment;
+		bool const MultiBind;
+		// Bindings set since the last bind()
+		std::uint32_t Dirty;
+		std::array<GLuint, BINDING_MAX> Buffers;
+		std::array<GLintptr, BINDING_MAX> Offsets;
+		std::array<GLsizeiptr, BINDING_MAX> Sizes;
+	};
+}//namespace gl
+
+#endif//UNIFORM_INCLUDED
@@ -1,4 +1,16 @@
+#include "registry.hpp"
+
 #include "test_compiler.hpp"
+#include "test_preprocess.hpp"
+#include "test_generate_mipmaps.hpp"
+#include "test_texture_compare.hpp"
+#include "test_texture_streaming.hpp"
+#include "test_texture_upload.hpp"
+#include "test_state_cache.hpp"
+#include "test_draw_textures.hpp"
+#include "test_compute.hpp"
+#include "test_draw_generation.hpp"
+#include "test_buffer_streaming.hpp"
 #include "test_draw_arrays.hpp"
 #include "test_draw_elements.hpp"
 #include "test_draw_arrays_vao.hpp"
@@ -9,478 +21,758 @@
 #include "test_draw_call.hpp"
 #include "test_small_primitive.hpp"
 #include "test_uniform_caching.hpp"
+#include <algorithm>
+#include <thread>
+
+// Entries run when --filter isn't given, the suite main used to run
+char const * const DEFAULT_FILTER("^buffer/");
 
-std::size_t const TEST_DUPLICATE_COUNT(1);
-std::size_t const TEST_FRAME_PER_RUN(100);
+registry::parameters drawCount(std::size_t DrawCount)
+{
+	registry::parameters Parameters;
+	Parameters["DrawCount"] = DrawCount;
+	return Parameters;
+}
 
-int drawArrays(int argc, char* argv[], csv & CSV)
+void drawArrays(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawArrays::drawType const & DrawType,
-			testDrawArrays::vertexDataType const & VertexDataType,
-			testDrawArrays::uniformUpdate const & UniformUpdate,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			DrawType(DrawType),
-			VertexDataType(VertexDataType),
-			UniformUpdate(UniformUpdate),
-			DrawCount(DrawCount)
-		{}
-
-		std::string const String;
-		testDrawArrays::drawType const DrawType;
-		testDrawArrays::vertexDataType const VertexDataType;
-		testDrawArrays::uniformUpdate const UniformUpdate;
-		std::size_t const DrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-	Entries.push_back(entry("DrawArrays(PACKED, SEPARATED)", testDrawArrays::DRAW_PACKED, testDrawArrays::SEPARATED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(PACKED, SHARED)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(PARAMS, SEPARATED)", testDrawArrays::DRAW_PARAMS, testDrawArrays::SEPARATED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(PARAMS, SHARED)", testDrawArrays::DRAW_PARAMS, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(MULTI, SEPARATED)", testDrawArrays::MULTI_DRAW, testDrawArrays::SEPARATED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(MULTI, SHARED)", testDrawArrays::MULTI_DRAW, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(DISCARD, SEPARATED)", testDrawArrays::MULTI_DISCARD, testDrawArrays::SEPARATED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(DISCARD, SHARED)", testDrawArrays::MULTI_DISCARD, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(INSTANCED, SHARED)", testDrawArrays::INSTANCED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testDrawArrays Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].DrawType, Entries[EntryIndex].VertexDataType, Entries[EntryIndex].UniformUpdate, Entries[EntryIndex].DrawCount);
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
-	}
+		char const * String;
+		testDrawArrays::drawType DrawType;
+		testDrawArrays::vertexDataType VertexDataType;
+	};
 
-	return Error;
+	entry const Entries[] =
+	{
+		{"DrawArrays(PACKED, SEPARATED)", testDrawArrays::DRAW_PACKED, testDrawArrays::SEPARATED_VERTEX_DATA},
+		{"DrawArrays(PACKED, SHARED)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA},
+		{"DrawArrays(PARAMS, SEPARATED)", testDrawArrays::DRAW_PARAMS, testDrawArrays::SEPARATED_VERTEX_DATA},
+		{"DrawArrays(PARAMS, SHARED)", testDrawArrays::DRAW_PARAMS, testDrawArrays::SHARED_VERTEX_DATA},
+		{"DrawArrays(MULTI, SEPARATED)", testDrawArrays::MULTI_DRAW, testDrawArrays::SEPARATED_VERTEX_DATA},
+		{"DrawArrays(MULTI, SHARED)", testDrawArrays::MULTI_DRAW, testDrawArrays::SHARED_VERTEX_DATA},
+		{"DrawArrays(DISCARD, SEPARATED)", testDrawArrays::MULTI_DISCARD, testDrawArrays::SEPARATED_VERTEX_DATA},
+		{"DrawArrays(DISCARD, SHARED)", testDrawArrays::MULTI_DISCARD, testDrawArrays::SHARED_VERTEX_DATA},
+		{"DrawArrays(INSTANCED, SHARED)", testDrawArrays::INSTANCED, testDrawArrays::SHARED_VERTEX_DATA}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("drawArrays", Entry.String, drawCount(100000), [Entry](registry::context const & Context)
+		{
+			testDrawArrays Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				Entry.DrawType, Entry.VertexDataType, testDrawArrays::CONSTANT_UNIFORM, Context.get("DrawCount"));
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawElements(int argc, char* argv[], csv & CSV)
+void drawElements(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawElements::drawType const & DrawType,
-			testDrawElements::vertexDataType const & VertexDataType,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			DrawType(DrawType),
-			VertexDataType(VertexDataType),
-			DrawCount(DrawCount)
-		{}
-
-		std::string const String;
-		testDrawElements::drawType const DrawType;
-		testDrawElements::vertexDataType const VertexDataType;
-		std::size_t const DrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-	Entries.push_back(entry("DrawElements(PACKED, SEPARATED)", testDrawElements::DRAW_PACKED, testDrawElements::SEPARATED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(PACKED, SHARED)", testDrawElements::DRAW_PACKED, testDrawElements::SHARED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(PARAMS, SEPARATED)", testDrawElements::DRAW_PARAMS, testDrawElements::SEPARATED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(PARAMS, SHARED)", testDrawElements::DRAW_PARAMS, testDrawElements::SHARED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(MULTI, SEPARATED)", testDrawElements::MULTI_DRAW, testDrawElements::SEPARATED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(MULTI, SHARED)", testDrawElements::MULTI_DRAW, testDrawElements::SHARED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(DISCARD, SEPARATED)", testDrawElements::MULTI_DISCARD, testDrawElements::SEPARATED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(DISCARD, SHARED)", testDrawElements::MULTI_DISCARD, testDrawElements::SHARED_VERTEX_DATA, 100000));
-	Entries.push_back(entry("DrawElements(INSTANCED, SHARED)", testDrawElements::INSTANCED, testDrawElements::SHARED_VERTEX_DATA, 100000));
-
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testDrawElements Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].DrawType, Entries[EntryIndex].VertexDataType, Entries[EntryIndex].DrawCount);
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
+		char const * String;
+		testDrawElements::drawType DrawType;
+		testDrawElements::vertexDataType VertexDataType;
+	};
+
+	entry const Entries[] =
+	{
+		{"DrawElements(PACKED, SEPARATED)", testDrawElements::DRAW_PACKED, testDrawElements::SEPARATED_VERTEX_DATA},
+		{"DrawElements(PACKED, SHARED)", testDrawElements::DRAW_PACKED, testDrawElements::SHARED_VERTEX_DATA},
+		{"DrawElements(PARAMS, SEPARATED)", testDrawElements::DRAW_PARAMS, testDrawElements::SEPARATED_VERTEX_DATA},
+		{"DrawElements(PARAMS, SHARED)", testDrawElements::DRAW_PARAMS, testDrawElements::SHARED_VERTEX_DATA},
+		{"DrawElements(MULTI, SEPARATED)", testDrawElements::MULTI_DRAW, testDrawElements::SEPARATED_VERTEX_DATA},
+		{"DrawElements(MULTI, SHARED)", testDrawElements::MULTI_DRAW, testDrawElements::SHARED_VERTEX_DATA},
+		{"DrawElements(DISCARD, SEPARATED)", testDrawElements::MULTI_DISCARD, testDrawElements::SEPARATED_VERTEX_DATA},
+		{"DrawElements(DISCARD, SHARED)", testDrawElements::MULTI_DISCARD, testDrawElements::SHARED_VERTEX_DATA},
+		{"DrawElements(INSTANCED, SHARED)", testDrawElements::INSTANCED, testDrawElements::SHARED_VERTEX_DATA}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("drawElements", Entry.String, drawCount(100000), [Entry](registry::context const & Context)
+		{
+			testDrawElements Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				Entry.DrawType, Entry.VertexDataType, Context.get("DrawCount"));
+			return Context.execute(Test);
+		});
 	}
+}
 
-	return Error;
+// Uniform update modes, including the direct state access variants
+void drawArraysUniform(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		testDrawArrays::drawType DrawType;
+		testDrawArrays::uniformUpdate UniformUpdate;
+	};
+
+	entry const Entries[] =
+	{
+		{"MultiDrawArrays(NO_UNIFORM)", testDrawArrays::MULTI_DRAW, testDrawArrays::NO_UNIFORM},
+		{"DrawArrays(NO_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::NO_UNIFORM},
+		{"DrawArrays(CONSTANT_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::CONSTANT_UNIFORM},
+		{"DrawArrays(PER_DRAW_UNIFORM_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::PER_DRAW_UNIFORM_B2E},
+		{"DrawArrays(PER_DRAW_UNIFORM_DSA)", testDrawArrays::DRAW_PACKED, testDrawArrays::PER_DRAW_UNIFORM_DSA},
+		{"DrawArrays(REDUNDANT_UNIFORM_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::REDUNDANT_UNIFORM_B2E},
+		{"DrawArrays(REDUNDANT_UNIFORM_DSA)", testDrawArrays::DRAW_PACKED, testDrawArrays::REDUNDANT_UNIFORM_DSA},
+		{"DrawArrays(PER_DRAW_UNIFORM2_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::PER_DRAW_UNIFORM2_B2E},
+		{"DrawArrays(REDUNDANT_UNIFORM2_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::REDUNDANT_UNIFORM2_B2E}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("drawArraysUniform", Entry.String, drawCount(100000), [Entry](registry::context const & Context)
+		{
+			testDrawArrays Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				Entry.DrawType, testDrawArrays::SHARED_VERTEX_DATA, Entry.UniformUpdate, Context.get("DrawCount"));
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawArraysUniform(int argc, char* argv[], csv & CSV)
+void drawArraysVAOs(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawArrays::drawType const & DrawType,
-			testDrawArrays::vertexDataType const & VertexDataType,
-			testDrawArrays::uniformUpdate const & UniformUpdate,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			DrawType(DrawType),
-			VertexDataType(VertexDataType),
-			UniformUpdate(UniformUpdate),
-			DrawCount(DrawCount)
-		{}
-
-		std::string const String;
-		testDrawArrays::drawType const DrawType;
-		testDrawArrays::vertexDataType const VertexDataType;
-		testDrawArrays::uniformUpdate const UniformUpdate;
-		std::size_t const DrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-	Entries.push_back(entry("MultiDrawArrays(NO_UNIFORM)", testDrawArrays::MULTI_DRAW, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::NO_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(NO_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::NO_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(CONSTANT_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::CONSTANT_UNIFORM, 100000));
-	Entries.push_back(entry("DrawArrays(PER_DRAW_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::PER_DRAW_UNIFORM_B2E, 100000));
-	Entries.push_back(entry("DrawArrays(REDUNDANT_UNIFORM)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::REDUNDANT_UNIFORM_B2E, 100000));
-	Entries.push_back(entry("DrawArrays(PER_DRAW_UNIFORM2)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::PER_DRAW_UNIFORM2_B2E, 100000));
-	Entries.push_back(entry("DrawArrays(REDUNDANT_UNIFORM2)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::REDUNDANT_UNIFORM2_B2E, 100000));
-
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testDrawArrays Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].DrawType, Entries[EntryIndex].VertexDataType, Entries[EntryIndex].UniformUpdate, Entries[EntryIndex].DrawCount);
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
+		char const * String;
+		testDrawArraysVAO::drawType DrawType;
+		testDrawArraysVAO::vaoMode VAOMode;
+	};
+
+	entry const Entries[] =
+	{
+		{"MultiDrawArrays(UNIQUE_VAO)", testDrawArraysVAO::MULTI_DRAW, testDrawArraysVAO::UNIQUE_VAO},
+		{"DrawArrays(UNIQUE_VAO)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::UNIQUE_VAO},
+		{"DrawArrays(VAOS_UNIQUE_BUFFER)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_UNIQUE_BUFFER},
+		{"DrawArrays(VAOS_SEPARATED_BUFFERS)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_SEPARATED_BUFFER},
+		{"DrawArrays(VABS_UNIQUE_BUFFER)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_UNIQUE_BUFFER},
+		{"DrawArrays(VABS_SEPARATED_BUFFERS)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VABS_SEPARATED_BUFFER}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("drawArraysVAOs", Entry.String, drawCount(100000), [Entry](registry::context const & Context)
+		{
+			testDrawArraysVAO Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				Entry.DrawType, Entry.VAOMode, Context.get("DrawCount"));
+			return Context.execute(Test);
+		});
 	}
+}
 
-	return Error;
+// The draw counts per viewport and per tile are parameters so they can be swept beyond the registered combinations
+void drawScreenspaceCoherence(registry & Registry)
+{
+	glm::uvec2 const TileSizes[] =
+	{
+		glm::uvec2(1024, 1024), glm::uvec2(512, 512), glm::uvec2(256, 256), glm::uvec2(128, 128),
+		glm::uvec2(64, 64), glm::uvec2(32, 32), glm::uvec2(16, 16), glm::uvec2(8, 8),
+		glm::uvec2(512, 64), glm::uvec2(512, 32), glm::uvec2(256, 64), glm::uvec2(256, 32)
+	};
+
+	glm::uvec2 const DrawCounts[] =
+	{
+		glm::uvec2(1, 100), glm::uvec2(10, 10), glm::uvec2(100, 1)
+	};
+
+	for(std::size_t DrawCountIndex(0); DrawCountIndex < sizeof(DrawCounts) / sizeof(glm::uvec2); ++DrawCountIndex)
+	for(std::size_t TileSizeIndex(0); TileSizeIndex < sizeof(TileSizes) / sizeof(glm::uvec2); ++TileSizeIndex)
+	{
+		glm::uvec2 const TileSize = TileSizes[TileSizeIndex];
+
+		registry::parameters Parameters;
+		Parameters["ViewportDrawCount"] = DrawCounts[DrawCountIndex].x;
+		Parameters["TileDrawCount"] = DrawCounts[DrawCountIndex].y;
+
+		Registry.add("screenspaceCoherence", format("Forward(%dx%d)", TileSize.x, TileSize.y), Parameters, [TileSize](registry::context const & Context)
+		{
+			testScreenspaceCoherence Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				glm::uvec2(1024, 1024), TileSize, Context.get("ViewportDrawCount"), Context.get("TileDrawCount"));
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawArraysDSA(int argc, char* argv[], csv & CSV)
+void compiler(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawArrays::drawType const & DrawType,
-			testDrawArrays::vertexDataType const & VertexDataType,
-			testDrawArrays::uniformUpdate const & UniformUpdate,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			DrawType(DrawType),
-			VertexDataType(VertexDataType),
-			UniformUpdate(UniformUpdate),
-			DrawCount(DrawCount)
-		{}
-
-		std::string const String;
-		testDrawArrays::drawType const DrawType;
-		testDrawArrays::vertexDataType const VertexDataType;
-		testDrawArrays::uniformUpdate const UniformUpdate;
-		std::size_t const DrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-	Entries.push_back(entry("DrawArrays(PER_DRAW_UNIFORM_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::PER_DRAW_UNIFORM_B2E, 100000));
-	Entries.push_back(entry("DrawArrays(PER_DRAW_UNIFORM_DSA)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::PER_DRAW_UNIFORM_DSA, 100000));
-	Entries.push_back(entry("DrawArrays(REDUNDANT_UNIFORM_B2E)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::REDUNDANT_UNIFORM_B2E, 100000));
-	Entries.push_back(entry("DrawArrays(REDUNDANT_UNIFORM_DSA)", testDrawArrays::DRAW_PACKED, testDrawArrays::SHARED_VERTEX_DATA, testDrawArrays::REDUNDANT_UNIFORM_DSA, 100000));
-
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testDrawArrays Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].DrawType, Entries[EntryIndex].VertexDataType, Entries[EntryIndex].UniformUpdate, Entries[EntryIndex].DrawCount);
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
+		char const * String;
+		testCompiler::mode Mode;
+	};
+
+	entry const Entries[] =
+	{
+		{"Multithreaded GLSL compiler", testCompiler::MULTITHREADED},
+		{"Dualthreaded GLSL compiler", testCompiler::DUALTHREADED},
+		{"Singlethreaded GLSL compiler", testCompiler::SINGLETHREADED},
+		{"Batched GLSL compiler", testCompiler::BATCHED},
+		{"Program binary cache GLSL compiler", testCompiler::PROGRAM_CACHE}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("compiler", Entry.String, registry::parameters(), [Entry](registry::context const & Context)
+		{
+			testCompiler Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode);
+			return Context.execute(Test);
+		});
 	}
 
-	return Error;
+	// The preprocessing throughput should not depend on the size of the includes
+	std::size_t const LineCounts[] = {100, 1000, 10000};
+
+	for(std::size_t LineCountIndex(0); LineCountIndex < sizeof(LineCounts) / sizeof(std::size_t); ++LineCountIndex)
+	{
+		registry::parameters Parameters;
+		Parameters["IncludeCount"] = 16;
+		Parameters["LineCount"] = LineCounts[LineCountIndex];
+
+		Registry.add("compiler", "Preprocess", Parameters, [](registry::context const & Context)
+		{
+			testPreprocess Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Context.get("IncludeCount"), Context.get("LineCount"));
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawArraysVAOs(int argc, char* argv[], csv & CSV)
+void generateMipmaps(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawArraysVAO::drawType const & DrawType,
-			testDrawArraysVAO::vaoMode const & VAOMode,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			DrawType(DrawType),
-			VAOMode(VAOMode),
-			DrawCount(DrawCount)
-		{}
-
-		std::string const String;
-		testDrawArraysVAO::drawType const DrawType;
-		testDrawArraysVAO::vaoMode const VAOMode;
-		std::size_t const DrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-	Entries.push_back(entry("MultiDrawArrays(UNIQUE_VAO)", testDrawArraysVAO::MULTI_DRAW, testDrawArraysVAO::UNIQUE_VAO, 100000));
-	Entries.push_back(entry("DrawArrays(UNIQUE_VAO)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::UNIQUE_VAO, 100000));
-	Entries.push_back(entry("DrawArrays(VAOS_UNIQUE_BUFFER)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_UNIQUE_BUFFER, 100000));
-	Entries.push_back(entry("DrawArrays(VAOS_SEPARATED_BUFFERS)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_SEPARATED_BUFFER, 100000));
-	Entries.push_back(entry("DrawArrays(VABS_UNIQUE_BUFFER)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VAOS_UNIQUE_BUFFER, 100000));
-	Entries.push_back(entry("DrawArrays(VABS_SEPARATED_BUFFERS)", testDrawArraysVAO::DRAW_PARAMS, testDrawArraysVAO::VABS_SEPARATED_BUFFER, 100000));
-
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testDrawArraysVAO Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].DrawType, Entries[EntryIndex].VAOMode, Entries[EntryIndex].DrawCount);
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
-	}
+		char const * String;
+		testGenerateMipmaps::mode Mode;
+		char const * Filename;
+	};
 
-	return Error;
+	entry const Entries[] =
+	{
+		{"GenerateMipmaps(REFERENCE, RGBA8_UNORM)", testGenerateMipmaps::REFERENCE, "kueken7_rgba8_unorm.dds"},
+		{"GenerateMipmaps(BOX, RGBA8_UNORM)", testGenerateMipmaps::BOX, "kueken7_rgba8_unorm.dds"},
+		{"GenerateMipmaps(KAISER, RGBA8_UNORM)", testGenerateMipmaps::KAISER, "kueken7_rgba8_unorm.dds"},
+		{"GenerateMipmaps(REFERENCE, RGBA8_SRGB)", testGenerateMipmaps::REFERENCE, "kueken7_rgba8_srgb.dds"},
+		{"GenerateMipmaps(BOX, RGBA8_SRGB)", testGenerateMipmaps::BOX, "kueken7_rgba8_srgb.dds"},
+		{"GenerateMipmaps(KAISER, RGBA8_SRGB)", testGenerateMipmaps::KAISER, "kueken7_rgba8_srgb.dds"},
+		{"GenerateMipmaps(REFERENCE, RGB8_UNORM)", testGenerateMipmaps::REFERENCE, "kueken7_rgb8_unorm.dds"},
+		{"GenerateMipmaps(BOX, RGB8_UNORM)", testGenerateMipmaps::BOX, "kueken7_rgb8_unorm.dds"},
+		{"GenerateMipmaps(BOX, RGBA16_SFLOAT)", testGenerateMipmaps::BOX, "kueken7_rgba16_sfloat.dds"},
+		{"GenerateMipmaps(KAISER, RGBA16_SFLOAT)", testGenerateMipmaps::KAISER, "kueken7_rgba16_sfloat.dds"},
+		{"GenerateMipmaps(BOX, RGB10A2_UNORM)", testGenerateMipmaps::BOX, "kueken7_rgb10a2_unorm.dds"},
+		{"GenerateMipmaps(BOX, RG11B10_UFLOAT)", testGenerateMipmaps::BOX, "kueken7_rg11b10_ufloat.dds"}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("generateMipmaps", Entry.String, registry::parameters(), [Entry](registry::context const & Context)
+		{
+			testGenerateMipmaps Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode, Entry.Filename);
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawScreenspaceCoherence(int argc, char* argv[], csv & CSV)
+void textureCompare(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			glm::uvec2 const & WindowSize,
-			glm::uvec2 const & TileSize,
-			std::size_t const ViewportDrawCount,
-			std::size_t const TileDrawCount
-		) :
-			String(String),
-			WindowSize(WindowSize),
-			TileSize(TileSize),
-			ViewportDrawCount(ViewportDrawCount),
-			TileDrawCount(TileDrawCount)
-		{}
-
-		std::string const String;
-		glm::uvec2 const WindowSize;
-		glm::uvec2 const TileSize;
-		std::size_t const ViewportDrawCount;
-		std::size_t const TileDrawCount;
-	};
-
-	int Error(0);
-
-	std::vector<entry> Entries;
-
-	Entries.push_back(entry("Forward(1024x1024 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1, 100));
-	Entries.push_back(entry("Forward(512x512 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1, 100));
-	Entries.push_back(entry("Forward(256x256 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1, 100));
-	Entries.push_back(entry("Forward(128x128 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1, 100));
-	Entries.push_back(entry("Forward(64x64 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1, 100));
-	Entries.push_back(entry("Forward(32x32 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1, 100));
-	Entries.push_back(entry("Forward(16x16 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1, 100));
-	Entries.push_back(entry("Forward(8x8 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1, 100));
-	Entries.push_back(entry("Forward(512x64 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 64), 1, 100));
-	Entries.push_back(entry("Forward(512x32 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 32), 1, 100));
-	Entries.push_back(entry("Forward(256x64 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 64), 1, 100));
-	Entries.push_back(entry("Forward(256x32 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 32), 1, 100));
-
-	Entries.push_back(entry("Forward(1024x1024 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 10, 10));
-	Entries.push_back(entry("Forward(512x512 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 10, 10));
-	Entries.push_back(entry("Forward(256x256 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 10, 10));
-	Entries.push_back(entry("Forward(128x128 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 10, 10));
-	Entries.push_back(entry("Forward(64x64 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 10, 10));
-	Entries.push_back(entry("Forward(32x32 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 10, 10));
-	Entries.push_back(entry("Forward(16x16 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 10, 10));
-	Entries.push_back(entry("Forward(8x8 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 10, 10));
-	Entries.push_back(entry("Forward(512x64 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 64), 10, 10));
-	Entries.push_back(entry("Forward(512x32 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 32), 10, 10));
-	Entries.push_back(entry("Forward(256x64 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 64), 10, 10));
-	Entries.push_back(entry("Forward(256x32 - 10x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 32), 10, 10));
-
-	Entries.push_back(entry("Forward(1024x1024 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 100, 1));
-	Entries.push_back(entry("Forward(512x512 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 100, 1));
-	Entries.push_back(entry("Forward(256x256 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 100, 1));
-	Entries.push_back(entry("Forward(128x128 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 100, 1));
-	Entries.push_back(entry("Forward(64x64 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 100, 1));
-	Entries.push_back(entry("Forward(32x32 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 100, 1));
-	Entries.push_back(entry("Forward(16x16 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 100, 1));
-	Entries.push_back(entry("Forward(8x8 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 100, 1));
-	Entries.push_back(entry("Forward(512x64 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 64), 100, 1));
-	Entries.push_back(entry("Forward(512x32 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 32), 100, 1));
-	Entries.push_back(entry("Forward(256x64 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 64), 100, 1));
-	Entries.push_back(entry("Forward(256x32 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 32), 100, 1));
-
-/*
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 1x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1, 1));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1, 10));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 1x viewport 10x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1, 10));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 10, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 10x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 10, 1));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 1x viewport 100x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1, 100));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 100, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 100x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 100, 1));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1, 100));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 1x viewport 1000x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1, 100));
-
-	Entries.push_back(entry("ScreenspaceCoherence(1024x1024 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(1024, 1024), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(512x512 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(512, 512), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(256x256 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(256, 256), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(128x128 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(128, 128), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(64x64 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(64, 64), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(32x32 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(32, 32), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(16x16 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(16, 16), 1000, 1));
-	Entries.push_back(entry("ScreenspaceCoherence(8x8 - 1000x viewport 1x tile)", glm::uvec2(1024, 1024), glm::uvec2(8, 8), 1000, 1));
-*/
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
-	{
-		testScreenspaceCoherence Test(
-			argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].WindowSize, Entries[EntryIndex].TileSize, Entries[EntryIndex].ViewportDrawCount, Entries[EntryIndex].TileDrawCount);
-
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
+		char const * String;
+		testTextureCompare::mode Mode;
+		char const * Filename;
+	};
+
+	entry const Entries[] =
+	{
+		{"REFERENCE, RGBA8_UNORM", testTextureCompare::REFERENCE, "kueken7_rgba8_unorm.dds"},
+		{"EQUAL, RGBA8_UNORM", testTextureCompare::EQUAL, "kueken7_rgba8_unorm.dds"},
+		{"DIFF, RGBA8_UNORM", testTextureCompare::DIFF, "kueken7_rgba8_unorm.dds"},
+		{"REFERENCE, RGBA16_SFLOAT", testTextureCompare::REFERENCE, "kueken7_rgba16_sfloat.dds"},
+		{"EQUAL, RGBA16_SFLOAT", testTextureCompare::EQUAL, "kueken7_rgba16_sfloat.dds"},
+		{"EQUAL_TOLERANT, RGBA16_SFLOAT", testTextureCompare::EQUAL_TOLERANT, "kueken7_rgba16_sfloat.dds"},
+		{"DIFF, RGBA16_SFLOAT", testTextureCompare::DIFF, "kueken7_rgba16_sfloat.dds"}
+	};
+
+	struct mismatch
+	{
+		char const * String;
+		testTextureCompare::mismatch Mismatch;
+	};
+
+	mismatch const Mismatches[] =
+	{
+		{"IDENTICAL", testTextureCompare::IDENTICAL},
+		{"MIDDLE_TEXEL", testTextureCompare::MIDDLE_TEXEL},
+		{"LAST_TEXEL", testTextureCompare::LAST_TEXEL}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	for(std::size_t MismatchIndex(0); MismatchIndex < sizeof(Mismatches) / sizeof(mismatch); ++MismatchIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		testTextureCompare::mismatch const Mismatch = Mismatches[MismatchIndex].Mismatch;
+
+		Registry.add("textureCompare", format("TextureCompare(%s, %s)", Entry.String, Mismatches[MismatchIndex].String), registry::parameters(),
+			[Entry, Mismatch](registry::context const & Context)
+		{
+			testTextureCompare Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode, Mismatch, Entry.Filename);
+			return Context.execute(Test);
+		});
 	}
+}
 
-	return Error;
+void textureStreaming(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		testTextureStreaming::mode Mode;
+		std::size_t SlotCount;
+		std::size_t SlotSize;
+		char const * Filename;
+	};
+
+	entry const Entries[] =
+	{
+		{"TextureStreaming(REFERENCE, RGBA8_UNORM)", testTextureStreaming::REFERENCE, 0, 0, "kueken7_rgba8_unorm.dds"},
+		{"TextureStreaming(RING, RGBA8_UNORM)", testTextureStreaming::RING, 4, 65536, "kueken7_rgba8_unorm.dds"},
+		{"TextureStreaming(REFERENCE, RGBA16_SFLOAT)", testTextureStreaming::REFERENCE, 0, 0, "kueken7_rgba16_sfloat.dds"},
+		{"TextureStreaming(RING, RGBA16_SFLOAT)", testTextureStreaming::RING, 4, 262144, "kueken7_rgba16_sfloat.dds"},
+		{"TextureStreaming(REFERENCE, RGBA_DXT5_UNORM)", testTextureStreaming::REFERENCE, 0, 0, "kueken7_rgba_dxt5_unorm.dds"},
+		{"TextureStreaming(RING, RGBA_DXT5_UNORM)", testTextureStreaming::RING, 4, 65536, "kueken7_rgba_dxt5_unorm.dds"}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+
+		registry::parameters Parameters;
+		if(Entry.Mode == testTextureStreaming::RING)
+		{
+			Parameters["SlotCount"] = Entry.SlotCount;
+			Parameters["SlotSize"] = Entry.SlotSize;
+		}
+
+		Registry.add("textureStreaming", Entry.String, Parameters, [Entry](registry::context const & Context)
+		{
+			bool const Ring = Entry.Mode == testTextureStreaming::RING;
+			testTextureStreaming Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode,
+				Ring ? Context.get("SlotCount") : 0, Ring ? Context.get("SlotSize") : 0, Entry.Filename);
+			return Context.execute(Test);
+		});
+	}
 }
 
-int compiler(int argc, char* argv[], csv & CSV)
+// The kueken7 DDS files, the formats the GL doesn't support fail in begin.
+// gli 0.6.1.1 can't load etc2_rgb8, la8_unorm, pvrtc2_4bpp, rgb_etc2_unorm, rgba_astc8x8_unorm and rgba_pvrtc2_4bpp_unorm
+void textureUpload(registry & Registry)
 {
-	int Error(0);
+	struct method
+	{
+		char const * String;
+		testTextureUpload::method Method;
+	};
+
+	method const Methods[] =
+	{
+		{"TEX_IMAGE", testTextureUpload::TEX_IMAGE},
+		{"TEX_STORAGE_SUB_IMAGE", testTextureUpload::TEX_STORAGE_SUB_IMAGE}
+	};
 
+	struct source
 	{
-		testCompiler Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN, testCompiler::MULTITHREADED);
-		Error += Test();
-		Test.log(CSV, "Multithreaded GLSL compiler");
+		char const * String;
+		testTextureUpload::source Source;
+	};
+
+	source const Sources[] =
+	{
+		{"CLIENT_MEMORY", testTextureUpload::CLIENT_MEMORY},
+		{"PIXEL_BUFFER", testTextureUpload::PIXEL_BUFFER}
+	};
+
+	struct file
+	{
+		char const * String;
+		char const * Filename;
+	};
+
+	file const Files[] =
+	{
+		{"A8_UNORM", "kueken7_a8_unorm.dds"},
+		{"BGRA8_SRGB", "kueken7_bgra8_srgb.dds"},
+		{"BGRA8_UNORM", "kueken7_bgra8_unorm.dds"},
+		{"ETC2_SRGB8", "kueken7_etc2_srgb8.dds"},
+		{"L8_UNORM", "kueken7_l8_unorm.dds"},
+		{"PVRTC_2BPP", "kueken7_pvrtc_2bpp.dds"},
+		{"R16_UNORM", "kueken7_r16_unorm.dds"},
+		{"R5G6B5_UNORM", "kueken7_r5g6b5_unorm.dds"},
+		{"R8_SNORM", "kueken7_r8_snorm.dds"},
+		{"R8_UNORM", "kueken7_r8_unorm.dds"},
+		{"R_ATI1N_UNORM", "kueken7_r_ati1n_unorm.dds"},
+		{"RG11B10_UFLOAT", "kueken7_rg11b10_ufloat.dds"},
+		{"RG_ATI2N_UNORM", "kueken7_rg_ati2n_unorm.dds"},
+		{"RGB10A2_UINT", "kueken7_rgb10a2_uint.dds"},
+		{"RGB10A2_UNORM", "kueken7_rgb10a2_unorm.dds"},
+		{"RGB8_SRGB", "kueken7_rgb8_srgb.dds"},
+		{"RGB8_UNORM", "kueken7_rgb8_unorm.dds"},
+		{"RGB9E5_UFLOAT", "kueken7_rgb9e5_ufloat.dds"},
+		{"RGB_ATC_UNORM", "kueken7_rgb_atc_unorm.dds"},
+		{"RGB_DXT1_SRGB", "kueken7_rgb_dxt1_srgb.dds"},
+		{"RGB_DXT1_UNORM", "kueken7_rgb_dxt1_unorm.dds"},
+		{"RGB_ETC1_UNORM", "kueken7_rgb_etc1_unorm.dds"},
+		{"RGB_ETC2_SRGB", "kueken7_rgb_etc2_srgb.dds"},
+		{"RGB_PVRTC_2BPP_UNORM", "kueken7_rgb_pvrtc_2bpp_unorm.dds"},
+		{"RGB_PVRTC_4BPP_UNORM", "kueken7_rgb_pvrtc_4bpp_unorm.dds"},
+		{"RGBA16_SFLOAT", "kueken7_rgba16_sfloat.dds"},
+		{"RGBA8_SNORM", "kueken7_rgba8_snorm.dds"},
+		{"RGBA8_SRGB", "kueken7_rgba8_srgb.dds"},
+		{"RGBA8_UNORM", "kueken7_rgba8_unorm.dds"},
+		{"RGBA_ATC_EXPLICIT_UNORM", "kueken7_rgba_atc_explicit_unorm.dds"},
+		{"RGBA_ATC_INTERPOLATE_UNORM", "kueken7_rgba_atc_interpolate_unorm.dds"},
+		{"RGBA_DXT5_SRGB", "kueken7_rgba_dxt5_srgb.dds"},
+		{"RGBA_DXT5_UNORM", "kueken7_rgba_dxt5_unorm.dds"}
+	};
+
+	for(std::size_t FileIndex(0); FileIndex < sizeof(Files) / sizeof(file); ++FileIndex)
+	for(std::size_t MethodIndex(0); MethodIndex < sizeof(Methods) / sizeof(method); ++MethodIndex)
+	for(std::size_t SourceIndex(0); SourceIndex < sizeof(Sources) / sizeof(source); ++SourceIndex)
+	{
+		testTextureUpload::method const Method = Methods[MethodIndex].Method;
+		testTextureUpload::source const Source = Sources[SourceIndex].Source;
+		std::string const Filename = Files[FileIndex].Filename;
+
+		registry::parameters Parameters;
+		Parameters["UploadCount"] = 16;
+
+		Registry.add("textureUpload", format("TextureUpload(%s, %s, %s)", Methods[MethodIndex].String, Sources[SourceIndex].String, Files[FileIndex].String), Parameters,
+			[Method, Source, Filename](registry::context const & Context)
+		{
+			testTextureUpload Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Method, Source, Filename, Context.get("UploadCount"));
+			return Context.execute(Test);
+		});
 	}
+}
+
+void drawIndexing(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		testDrawIndexing::indexing Indexing;
+	};
+
+	entry const Entries[] =
+	{
+		{"DrawIndexed(UNIFORM_INDEXING)", testDrawIndexing::UNIFORM_INDEXING},
+		{"DrawIndexed(ATTRIB_INDEXING)", testDrawIndexing::ATTRIB_INDEXING},
+		{"DrawIndexed(DIVISOR_INDEXING)", testDrawIndexing::DIVISOR_INDEXING},
+		{"DrawIndexed(DIVISOR_MULTI_INDEXING)", testDrawIndexing::DIVISOR_MULTI_INDEXING},
+		{"DrawIndexed(ID_INDEXING)", testDrawIndexing::ID_INDEXING},
+		{"DrawIndexed(NO_INDEXING)", testDrawIndexing::DRAW}
+	};
 
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
 	{
-		testCompiler Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN, testCompiler::DUALTHREADED);
-		Error += Test();
-		Test.log(CSV, "Dualthreaded GLSL compiler");
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("drawIndexing", Entry.String, drawCount(100000), [Entry](registry::context const & Context)
+		{
+			testDrawIndexing Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Indexing, Context.get("DrawCount"));
+			return Context.execute(Test);
+		});
 	}
+}
+
+void stateCache(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		testStateCache::mode Mode;
+	};
+
+	entry const Entries[] =
+	{
+		{"StateCache(DIRECT)", testStateCache::DIRECT},
+		{"StateCache(CACHED)", testStateCache::CACHED},
+		{"StateCache(SORTED)", testStateCache::SORTED}
+	};
+
+	std::size_t const MaterialCounts[] = {16, 1000};
 
+	for(std::size_t MaterialIndex(0); MaterialIndex < sizeof(MaterialCounts) / sizeof(std::size_t); ++MaterialIndex)
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
 	{
-		testCompiler Test(argc, argv, test::CORE, TEST_FRAME_PER_RUN, testCompiler::SINGLETHREADED);
-		Error += Test();
-		Test.log(CSV, "Singlethreaded GLSL compiler");
+		entry const Entry = Entries[EntryIndex];
+
+		registry::parameters Parameters = drawCount(10000);
+		Parameters["MaterialCount"] = MaterialCounts[MaterialIndex];
+
+		Registry.add("stateCache", Entry.String, Parameters, [Entry](registry::context const & Context)
+		{
+			testStateCache Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode, Context.get("DrawCount"), Context.get("MaterialCount"));
+			return Context.execute(Test);
+		});
 	}
+}
 
-	return Error;
+void drawTextures(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		testDrawTextures::mode Mode;
+	};
+
+	entry const Entries[] =
+	{
+		{"DrawTextures(BIND_PER_DRAW)", testDrawTextures::BIND_PER_DRAW},
+		{"DrawTextures(MULTI_BIND)", testDrawTextures::MULTI_BIND},
+		{"DrawTextures(TEXTURE_ARRAY)", testDrawTextures::TEXTURE_ARRAY},
+		{"DrawTextures(BINDLESS_UBO)", testDrawTextures::BINDLESS_UBO},
+		{"DrawTextures(BINDLESS_SSBO)", testDrawTextures::BINDLESS_SSBO},
+		{"DrawTextures(BINDLESS_MULTI_DRAW)", testDrawTextures::BINDLESS_MULTI_DRAW}
+	};
+
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+
+		registry::parameters Parameters = drawCount(1000);
+		Parameters["TextureCount"] = 1000;
+
+		Registry.add("drawTextures", Entry.String, Parameters, [Entry](registry::context const & Context)
+		{
+			testDrawTextures Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Entry.Mode, Context.get("DrawCount"), Context.get("TextureCount"));
+			return Context.execute(Test);
+		});
+	}
 }
 
-int drawIndexing(int argc, char* argv[], csv & CSV)
+// Compute entries sweep the memory pattern, TinyDispatch entries submit many dispatches of a single work group
+void compute(registry & Registry)
 {
 	struct entry
 	{
-		entry(
-			std::string const & String,
-			testDrawIndexing::indexing const & Indexing,
-			std::size_t const & DrawCount
-		) :
-			String(String),
-			Indexing(Indexing),
-			DrawCount(DrawCount)
-		{}
+		char const * String;
+		testCompute::pattern Pattern;
+		testCompute::barrier Barrier;
+		std::size_t InvocationCount;
+		std::size_t DispatchCount;
+	};
 
-		std::string const String;
-		testDrawIndexing::indexing const Indexing;
-		std::size_t const DrawCount;
+	entry const Entries[] =
+	{
+		{"Compute(COALESCED)", testCompute::COALESCED, testCompute::BARRIER_NONE, 1 << 20, 1},
+		{"Compute(STRIDED)", testCompute::STRIDED, testCompute::BARRIER_NONE, 1 << 20, 1},
+		{"Compute(ATOMIC)", testCompute::ATOMIC, testCompute::BARRIER_NONE, 1 << 20, 1},
+		{"Compute(SHARED_REDUCTION)", testCompute::SHARED_REDUCTION, testCompute::BARRIER_NONE, 1 << 20, 1},
+		{"TinyDispatch(BARRIER_NONE)", testCompute::COALESCED, testCompute::BARRIER_NONE, 64, 1000},
+		{"TinyDispatch(BARRIER_STORAGE)", testCompute::COALESCED, testCompute::BARRIER_STORAGE, 64, 1000}
 	};
 
-	int Error(0);
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+
+		registry::parameters Parameters;
+		Parameters["LocalSizeX"] = 64;
+		Parameters["LocalSizeY"] = 1;
+		Parameters["LocalSizeZ"] = 1;
+		Parameters["InvocationCount"] = Entry.InvocationCount;
+		Parameters["DispatchCount"] = Entry.DispatchCount;
+
+		Registry.add("compute", Entry.String, Parameters, [Entry](registry::context const & Context)
+		{
+			glm::uvec3 const LocalSize(
+				static_cast<glm::uint>(Context.get("LocalSizeX")),
+				static_cast<glm::uint>(Context.get("LocalSizeY")),
+				static_cast<glm::uint>(Context.get("LocalSizeZ")));
+
+			testCompute Test(Context.argc, Context.argv, test::CORE, Context.FrameCount,
+				Entry.Pattern, Entry.Barrier, LocalSize, Context.get("InvocationCount"), Context.get("DispatchCount"));
+			return Context.execute(Test);
+		});
+	}
+}
+
+// ThreadCount from 1 to the hardware concurrency by powers of two
+void drawGeneration(registry & Registry)
+{
+	std::size_t const MaxThreadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	for(std::size_t ThreadCount(1); ; ThreadCount = std::min(ThreadCount * 2, MaxThreadCount))
+	{
+		registry::parameters Parameters = drawCount(100000);
+		Parameters["ThreadCount"] = ThreadCount;
 
-	std::vector<entry> Entries;
+		Registry.add("drawGeneration", "DrawGeneration", Parameters, [](registry::context const & Context)
+		{
+			testDrawGeneration Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Context.get("DrawCount"), Context.get("ThreadCount"));
+			return Context.execute(Test);
+		});
 
-	Entries.push_back(entry("DrawIndexed(UNIFORM_INDEXING, 100000)", testDrawIndexing::UNIFORM_INDEXING, 100000));
-	Entries.push_back(entry("DrawIndexed(ATTRIB_INDEXING, 100000)", testDrawIndexing::ATTRIB_INDEXING, 100000));
-	Entries.push_back(entry("DrawIndexed(DIVISOR_INDEXING, 100000)", testDrawIndexing::DIVISOR_INDEXING, 100000));
-	Entries.push_back(entry("DrawIndexed(DIVISOR_MULTI_INDEXING, 100000)", testDrawIndexing::DIVISOR_MULTI_INDEXING, 100000));
-	Entries.push_back(entry("DrawIndexed(ID_INDEXING, 100000)", testDrawIndexing::ID_INDEXING, 100000));
-	Entries.push_back(entry("DrawIndexed(NO_INDEXING, 100000)", testDrawIndexing::DRAW, 100000));
+		if(ThreadCount == MaxThreadCount)
+			break;
+	}
+}
+
+void buffer(registry & Registry)
+{
+	struct entry
+	{
+		char const * String;
+		test_buffer::vertexFormat VertexFormat;
+	};
 
-	for(std::size_t EntryIndex(0); EntryIndex < Entries.size(); ++EntryIndex)
-	for(std::size_t TestIndex(0); TestIndex < TEST_DUPLICATE_COUNT; ++TestIndex)
+	entry const Entries[] =
 	{
-		testDrawIndexing Test(
-			argc, argv, test::CORE, TEST_FRAME_PER_RUN,
-			Entries[EntryIndex].Indexing, Entries[EntryIndex].DrawCount);
+		{"VertexFormat(U8VEC4)", test_buffer::U8VEC4},
+		{"VertexFormat(F16VEC4)", test_buffer::F16VEC4},
+		{"VertexFormat(F16VEC3)", test_buffer::F16VEC3},
+		{"VertexFormat(F32VEC4)", test_buffer::F32VEC4},
+		{"VertexFormat(F64VEC4)", test_buffer::F64VEC4}
+	};
 
-		Error += Test();
-		Test.log(CSV, Entries[EntryIndex].String.c_str());
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add("buffer", Entry.String, registry::parameters(), [Entry](registry::context const & Context)
+		{
+			test_buffer Test(Context.argc, Context.argv, Context.FrameCount, glm::uvec2(256), Entry.VertexFormat);
+			return Context.execute(Test);
+		});
 	}
+}
 
-	return Error;
+// UploadKB is rounded up to a multiple of 16 KB
+void bufferStreaming(registry & Registry)
+{
+	struct strategy
+	{
+		char const * String;
+		testBufferStreaming::strategy Strategy;
+	};
+
+	strategy const Strategies[] =
+	{
+		{"ORPHAN", testBufferStreaming::ORPHAN},
+		{"SUB_DATA", testBufferStreaming::SUB_DATA},
+		{"MAP_INVALIDATE", testBufferStreaming::MAP_INVALIDATE},
+		{"MAP_UNSYNCHRONIZED", testBufferStreaming::MAP_UNSYNCHRONIZED},
+		{"PERSISTENT_COHERENT", testBufferStreaming::PERSISTENT_COHERENT},
+		{"PERSISTENT_FLUSH", testBufferStreaming::PERSISTENT_FLUSH},
+		{"PINNED_AMD", testBufferStreaming::PINNED_AMD}
+	};
+
+	struct target
+	{
+		char const * String;
+		testBufferStreaming::target Target;
+	};
+
+	target const Targets[] =
+	{
+		{"VERTEX", testBufferStreaming::VERTEX_DATA},
+		{"UNIFORM", testBufferStreaming::UNIFORM_DATA}
+	};
+
+	for(std::size_t TargetIndex(0); TargetIndex < sizeof(Targets) / sizeof(target); ++TargetIndex)
+	for(std::size_t StrategyIndex(0); StrategyIndex < sizeof(Strategies) / sizeof(strategy); ++StrategyIndex)
+	{
+		testBufferStreaming::strategy const Strategy = Strategies[StrategyIndex].Strategy;
+		testBufferStreaming::target const Target = Targets[TargetIndex].Target;
+
+		registry::parameters Parameters;
+		Parameters["UploadKB"] = 4096;
+
+		Registry.add("bufferStreaming", format("BufferStreaming(%s, %s)", Strategies[StrategyIndex].String, Targets[TargetIndex].String), Parameters,
+			[Strategy, Target](registry::context const & Context)
+		{
+			testBufferStreaming Test(Context.argc, Context.argv, test::CORE, Context.FrameCount, Strategy, Target, Context.get("UploadKB") * 1024);
+			return Context.execute(Test);
+		});
+	}
 }
 
-int main(int argc, char* argv[])
+// These suites keep their own entry lists, frame counts and output files
+void standalone(registry & Registry)
 {
-	int Error(0);
-/*
-	Error += main_small_primitive_debug(argc, argv);
-	Error += main_small_primitive1(argc, argv);
-	Error += main_small_primitive2(argc, argv);
-	Error += main_small_primitive3(argc, argv);
-	Error += main_small_primitive4_memory_layout(argc, argv);
-	Error += main_small_primitive5(argc, argv);
-	Error += main_small_primitive6(argc, argv);
-*/
+	struct entry
+	{
+		char const * Suite;
+		char const * String;
+		int (*Main)(int argc, char* argv[]);
+	};
 
-//	Error += main_draw_call(argc, argv);
+	entry const Entries[] =
+	{
+		{"smallPrimitive", "debug", main_small_primitive_debug},
+		{"smallPrimitive", "1", main_small_primitive1},
+		{"smallPrimitive", "2", main_small_primitive2},
+		{"smallPrimitive", "3", main_small_primitive3},
+		{"smallPrimitive", "4_memory_layout", main_small_primitive4_memory_layout},
+		{"smallPrimitive", "5", main_small_primitive5},
+		{"smallPrimitive", "6", main_small_primitive6},
+		{"drawCall", "main", main_draw_call},
+		{"uniformCaching", "main", main_uniform_caching}
+	};
 
-//	Error += main_uniform_caching(argc, argv);
+	for(std::size_t EntryIndex(0); EntryIndex < sizeof(Entries) / sizeof(entry); ++EntryIndex)
+	{
+		entry const Entry = Entries[EntryIndex];
+		Registry.add(Entry.Suite, Entry.String, registry::parameters(), [Entry](registry::context const & Context)
+		{
+			return Entry.Main(Context.argc, Context.argv);
+		});
+	}
+}
 
-	Error += main_buffer(argc, argv);
+int main(int argc, char* argv[])
+{
+	registry::options Options;
+	Options.Filter = DEFAULT_FILTER;
+	if(!registry::parse(argc, argv, Options))
+	{
+		registry::usage();
+		return 1;
+	}
+
+	registry Registry;
+	drawArrays(Registry);
+	drawElements(Registry);
+	drawArraysUniform(Registry);
+	drawArraysVAOs(Registry);
+	drawScreenspaceCoherence(Registry);
+	compiler(Registry);
+	generateMipmaps(Registry);
+	textureCompare(Registry);
+	textureStreaming(Registry);
+	textureUpload(Registry);
+	drawIndexing(Registry);
+	stateCache(Registry);
+	drawTextures(Registry);
+	compute(Registry);
+	drawGeneration(Registry);
+	buffer(Registry);
+	bufferStreaming(Registry);
+	standalone(Registry);
+
+	if(Options.List)
+		return Registry.run(argc, argv, Options);
+
+	// Create the window and context once for all the tests instead of once per entry
+	test::beginSharedContext();
+	int const Error = Registry.run(argc, argv, Options);
+	test::endSharedContext();
 
 	return Error;
 }
-
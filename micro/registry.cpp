@@ -0,0 +1,286 @@
+#include "registry.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <set>
+
+namespace
+{
+	bool parseSize(std::string const & String, std::size_t & Value)
+	{
+		if(String.empty())
+			return false;
+
+		char* End = nullptr;
+		unsigned long long const Result = std::strtoull(String.c_str(), &End, 10);
+		if(*End != '\0')
+			return false;
+
+		Value = static_cast<std::size_t>(Result);
+		return true;
+	}
+
+	std::vector<std::string> split(std::string const & String, char Separator)
+	{
+		std::vector<std::string> Tokens;
+
+		std::size_t Begin = 0;
+		for(std::size_t End = String.find(Separator); End != std::string::npos; End = String.find(Separator, Begin))
+		{
+			Tokens.push_back(String.substr(Begin, End - Begin));
+			Begin = End + 1;
+		}
+		Tokens.push_back(String.substr(Begin));
+
+		return Tokens;
+	}
+
+	// <Parameter>=<Value>[,<Value>...] or <Parameter>=<First>:<Last>:<Count>[:log]
+	bool parseSweep(std::string const & String, std::string & Name, std::vector<std::size_t> & Values)
+	{
+		std::size_t const Equal = String.find('=');
+		if(Equal == 0 || Equal == std::string::npos)
+			return false;
+
+		Name = String.substr(0, Equal);
+		std::string const Range = String.substr(Equal + 1);
+
+		Values.clear();
+		if(Range.find(':') == std::string::npos)
+		{
+			std::vector<std::string> const Tokens = split(Range, ',');
+			for(std::size_t i = 0; i < Tokens.size(); ++i)
+			{
+				std::size_t Value = 0;
+				if(!parseSize(Tokens[i], Value))
+					return false;
+				Values.push_back(Value);
+			}
+			return true;
+		}
+
+		std::vector<std::string> const Tokens = split(Range, ':');
+		if(Tokens.size() != 3 && Tokens.size() != 4)
+			return false;
+
+		bool const Logarithmic = Tokens.size() == 4;
+		if(Logarithmic && Tokens[3] != "log")
+			return false;
+
+		std::size_t First = 0, Last = 0, Count = 0;
+		if(!parseSize(Tokens[0], First) || !parseSize(Tokens[1], Last) || !parseSize(Tokens[2], Count) || Count == 0)
+			return false;
+		if(Logarithmic && (First == 0 || Last == 0))
+			return false;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const Step = Count > 1 ? static_cast<double>(i) / static_cast<double>(Count - 1) : 0.0;
+			double const Value = Logarithmic ?
+				static_cast<double>(First) * std::pow(static_cast<double>(Last) / static_cast<double>(First), Step) :
+				static_cast<double>(First) + (static_cast<double>(Last) - static_cast<double>(First)) * Step;
+
+			std::size_t const Rounded = static_cast<std::size_t>(Value + 0.5);
+			if(Values.empty() || Values.back() != Rounded)
+				Values.push_back(Rounded);
+		}
+
+		return true;
+	}
+
+	// Cartesian product of the sweeps applying to the parameters of an entry
+	std::vector<registry::parameters> expand(registry::parameters const & Defaults, std::map<std::string, std::vector<std::size_t> > const & Sweeps)
+	{
+		std::vector<registry::parameters> Result(1, Defaults);
+
+		for(std::map<std::string, std::vector<std::size_t> >::const_iterator it = Sweeps.begin(); it != Sweeps.end(); ++it)
+		{
+			if(Defaults.find(it->first) == Defaults.end())
+				continue;
+
+			std::vector<registry::parameters> Expanded;
+			for(std::size_t i = 0; i < Result.size(); ++i)
+			for(std::size_t j = 0; j < it->second.size(); ++j)
+			{
+				Expanded.push_back(Result[i]);
+				Expanded.back()[it->first] = it->second[j];
+			}
+			Result.swap(Expanded);
+		}
+
+		return Result;
+	}
+
+	std::string label(std::string const & Name, registry::parameters const & Parameters)
+	{
+		std::string Label = Name;
+		for(registry::parameters::const_iterator it = Parameters.begin(); it != Parameters.end(); ++it)
+			Label += format(" %s=%d", it->first.c_str(), static_cast<int>(it->second));
+		return Label;
+	}
+}//namespace
+
+registry::options::options() :
+	RepeatCount(1),
+	FrameCount(100),
+	WarmupCount(0),
+	List(false)
+{}
+
+registry::context::context(int argc, char* argv[], std::size_t FrameCount, parameters const & Parameters, csv & CSV, std::string const & String) :
+	argc(argc),
+	argv(argv),
+	FrameCount(FrameCount),
+	Parameters(Parameters),
+	CSV(CSV),
+	String(String)
+{}
+
+std::size_t registry::context::get(char const * Name) const
+{
+	parameters::const_iterator it = this->Parameters.find(Name);
+	assert(it != this->Parameters.end());
+	return it->second;
+}
+
+int registry::context::execute(test & Test) const
+{
+	int const Error = Test();
+	Test.log(this->CSV, this->String.c_str());
+	return Error;
+}
+
+bool registry::parse(int argc, char* argv[], options & Options)
+{
+	for(int i = 1; i < argc; ++i)
+	{
+		std::string const Argument(argv[i]);
+
+		if(Argument == "--list")
+		{
+			Options.List = true;
+			continue;
+		}
+
+		if(Argument != "--filter" && Argument != "--sweep" && Argument != "--repeat" && Argument != "--frames" && Argument != "--warmup" && Argument != "--output")
+			continue;
+
+		if(i + 1 >= argc)
+		{
+			fprintf(stderr, "Missing value for %s\n", argv[i]);
+			return false;
+		}
+		std::string const Value(argv[++i]);
+
+		bool Valid = true;
+		if(Argument == "--filter")
+			Options.Filter = Value;
+		else if(Argument == "--output")
+			Options.Output = Value;
+		else if(Argument == "--repeat")
+			Valid = parseSize(Value, Options.RepeatCount) && Options.RepeatCount > 0;
+		else if(Argument == "--frames")
+			Valid = parseSize(Value, Options.FrameCount) && Options.FrameCount > 0;
+		else if(Argument == "--warmup")
+			Valid = parseSize(Value, Options.WarmupCount);
+		else if(Argument == "--sweep")
+		{
+			std::string Name;
+			std::vector<std::size_t> Values;
+			Valid = parseSweep(Value, Name, Values);
+			if(Valid)
+				Options.Sweeps[Name] = Values;
+		}
+
+		if(!Valid)
+		{
+			fprintf(stderr, "Invalid value for %s: %s\n", Argument.c_str(), Value.c_str());
+			return false;
+		}
+	}
+
+	if(Options.WarmupCount >= Options.FrameCount)
+	{
+		fprintf(stderr, "--warmup must be lower than --frames\n");
+		return false;
+	}
+
+	return true;
+}
+
+void registry::usage()
+{
+	fprintf(stdout,
+		"micro [--list] [--filter <regex>] [--sweep <Parameter>=<Values>]... [--repeat <N>] [--frames <N>] [--warmup <N>] [--output <file>]\n"
+		"  --sweep DrawCount=100,1000   Runs each selected entry with DrawCount 100 then 1000\n"
+		"  --sweep DrawCount=1:1000000:7:log   Runs DrawCount 1, 10, 100, ... 1000000\n");
+}
+
+void registry::add(char const * Suite, std::string const & Name, parameters const & Parameters, function const & Function)
+{
+	entry Entry;
+	Entry.Name = std::string(Suite) + "/" + Name;
+	Entry.Parameters = Parameters;
+	Entry.Function = Function;
+	this->Entries.push_back(Entry);
+}
+
+int registry::run(int argc, char* argv[], options const & Options) const
+{
+	std::regex Filter;
+	try
+	{
+		Filter = std::regex(Options.Filter);
+	}
+	catch(std::regex_error const & Error)
+	{
+		fprintf(stderr, "Invalid filter %s: %s\n", Options.Filter.c_str(), Error.what());
+		return 1;
+	}
+
+	csv CSV(Options.WarmupCount);
+	int Error(0);
+
+	// Entries registered with different defaults of a swept parameter expand to the same runs
+	std::set<std::string> Labels;
+
+	for(std::size_t EntryIndex = 0; EntryIndex < this->Entries.size(); ++EntryIndex)
+	{
+		entry const & Entry = this->Entries[EntryIndex];
+		if(!std::regex_search(Entry.Name, Filter))
+			continue;
+
+		std::vector<parameters> const Runs = expand(Entry.Parameters, Options.Sweeps);
+		for(std::size_t RunIndex = 0; RunIndex < Runs.size(); ++RunIndex)
+		{
+			std::string const Label = label(Entry.Name, Runs[RunIndex]);
+			if(!Labels.insert(Label).second)
+				continue;
+
+			if(Options.List)
+			{
+				fprintf(stdout, "%s\n", Label.c_str());
+				continue;
+			}
+
+			for(std::size_t RepeatIndex = 0; RepeatIndex < Options.RepeatCount; ++RepeatIndex)
+				Error += Entry.Function(context(argc, argv, Options.FrameCount, Runs[RunIndex], CSV, Label));
+		}
+	}
+
+	if(Options.List)
+		return Error;
+
+	CSV.print();
+
+	if(!Options.Output.empty())
+	{
+		std::size_t const Extension = Options.Output.rfind(".jsonl");
+		bool const JSONLines = Extension != std::string::npos && Extension + 6 == Options.Output.size();
+		CSV.save(Options.Output.c_str(), JSONLines ? csv::FORMAT_JSON_LINES : csv::FORMAT_CSV);
+	}
+
+	return Error;
+}
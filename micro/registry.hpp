@@ -0,0 +1,78 @@
+#ifndef REGISTRY_INCLUDED
+#define REGISTRY_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+// Runtime selection of the micro benchmarks, replacing the compile time entry lists.
+// Each entry is named "suite/Name" and declares its numeric parameters with default values,
+// the command line filters the entries and sweeps any of these parameters.
+class registry
+{
+public:
+	typedef std::map<std::string, std::size_t> parameters;
+
+	struct options
+	{
+		options();
+
+		std::string Filter;
+		std::size_t RepeatCount;
+		std::size_t FrameCount;
+		// Number of first frames of each run excluded from the statistics
+		std::size_t WarmupCount;
+		std::string Output;
+		bool List;
+		std::map<std::string, std::vector<std::size_t> > Sweeps;
+	};
+
+	// What a registered function receives to construct and run its test
+	struct context
+	{
+		context(int argc, char* argv[], std::size_t FrameCount, parameters const & Parameters, csv & CSV, std::string const & String);
+
+		std::size_t get(char const * Name) const;
+		int execute(test & Test) const;
+
+		int const argc;
+		char** const argv;
+		std::size_t const FrameCount;
+		parameters const & Parameters;
+		csv & CSV;
+		std::string const String;
+	};
+
+	typedef std::function<int(context const & Context)> function;
+
+	// Options recognized:
+	// --list: Print the selected entries and their parameters without running them
+	// --filter <regex>: Select the entries which "suite/Name" matches the ECMAScript regex
+	// --sweep <Parameter>=<Value>[,<Value>...]: Run each selected entry for each value
+	// --sweep <Parameter>=<First>:<Last>:<Count>[:log]: Linearly or logarithmically spaced values
+	// --repeat <N>, --frames <N>, --warmup <N>: Runs per entry, frames per run, frames discarded per run
+	// --output <file>: CSV file, or JSON lines when the extension is .jsonl
+	// Other arguments are left to the tests, for example --headless.
+	static bool parse(int argc, char* argv[], options & Options);
+	static void usage();
+
+	void add(char const * Suite, std::string const & Name, parameters const & Parameters, function const & Function);
+
+	// Returns the sum of the errors of the selected entries or 1 if the filter is invalid
+	int run(int argc, char* argv[], options const & Options) const;
+
+private:
+	struct entry
+	{
+		std::string Name;
+		parameters Parameters;
+		function Function;
+	};
+
+	std::vector<entry> Entries;
+};
+
+#endif//REGISTRY_INCLUDED
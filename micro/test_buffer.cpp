@@ -21,16 +21,8 @@
 /// THE SOFTWARE.
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include "test.hpp"
 #include "test_buffer.hpp"
 
-#define TEST_U8VEC4		1
-#define TEST_F16VEC4	2
-#define TEST_F16VEC3	3
-#define TEST_F32VEC4	4
-#define TEST_F64VEC4	5
-#define TEST TEST_F16VEC3
-
 namespace
 {
 	char const * VERT_SHADER_SOURCE_F32("micro/test_buffer.vert");
@@ -137,354 +129,209 @@ namespace
 		glm::dvec4 Color[8];
 	};
 
-	struct attrib
+	struct vertexFormatInfo
 	{
 		GLint Size;
 		GLenum Type;
 		GLboolean Normalized;
-		const void* Offset;
+		std::size_t ColorSize;
+		std::size_t VertexSize;
 	};
 
-	std::size_t const AttribSize = 13;
-
-#	if TEST == TEST_F64VEC4
-		attrib const Attribs[] =
-		{
-			{ 2, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(0) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2)) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 1) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 2) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 3) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 4) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 5) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 6) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 7) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 8) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 9) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 10) },
-			{ 4, GL_DOUBLE, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::dvec4) * 11) }
-		};
-		typedef vertex_f64color4 vertex;
-
-#	elif TEST == TEST_F32VEC4
-		attrib const Attribs[AttribSize] =
-		{
-			{ 2, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(0) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2)) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 1) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 2) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 3) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 4) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 5) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 6) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 7) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 8) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 9) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 10) },
-			{ 4, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::vec4) * 11) }
-		};
-		typedef vertex_f32color4 vertex;
-
-#	elif TEST == TEST_F16VEC4
-		attrib const Attribs[AttribSize] =
-		{
-			{ 2, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(0) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2)) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 1) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 2) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 3) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 4) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 5) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 6) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 7) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 8) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 9) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 10) },
-			{ 4, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec4) * 11) }
-		};
-		typedef vertex_f16color4 vertex;
-
-#	elif TEST == TEST_F16VEC3
-	attrib const Attribs[AttribSize] =
+	vertexFormatInfo const Formats[test_buffer::VERTEX_FORMAT_MAX] =
 	{
-		{ 2, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(0) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2)) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 1) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 2) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 3) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 4) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 5) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 6) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 7) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 8) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 9) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 10) },
-		{ 3, GL_HALF_FLOAT, GL_FALSE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u16vec3) * 11) }
+		{ 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(glm::u8vec4), sizeof(vertex_u8color4) },
+		{ 4, GL_HALF_FLOAT, GL_FALSE, sizeof(glm::u16vec4), sizeof(vertex_f16color4) },
+		{ 3, GL_HALF_FLOAT, GL_FALSE, sizeof(glm::u16vec3), sizeof(vertex_f16color3) },
+		{ 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), sizeof(vertex_f32color4) },
+		{ 4, GL_DOUBLE, GL_FALSE, sizeof(glm::dvec4), sizeof(vertex_f64color4) }
 	};
-	typedef vertex_f16color3 vertex;
 
-#	elif TEST == TEST_U8VEC4
-		attrib const Attribs[AttribSize] =
-		{
-			{ 2, GL_FLOAT, GL_FALSE, BUFFER_OFFSET(0) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2)) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 1) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 2) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 3) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 4) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 5) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 6) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 7) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 8) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 9) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 10) },
-			{ 4, GL_UNSIGNED_BYTE, GL_TRUE, BUFFER_OFFSET(sizeof(glm::vec2) + sizeof(glm::u8vec4) * 11) }
-		};
-		typedef vertex_u8color4 vertex;
-
-#	endif//TEST
-
-	namespace buffer
-	{
-		enum type
-		{
-			VERTEX,
-			ELEMENT,
-			TRANSFORM,
-			MAX
-		};
-	}//namespace buffer
-}//namespace
+	// The position followed by the colors, all the vertex formats have twelve colors
+	std::size_t const AttribCount = 13;
 
-class test_buffer : public test
-{
-public:
-	test_buffer(int argc, char* argv[], std::size_t FrameCount, glm::uvec2 const & WindowSize)
-		: test(argc, argv, "test_buffer", test::CORE, 3, 3, FrameCount, RUN_ONLY, WindowSize)
-		, VertexArrayName(0)
-		, ProgramName(0)
-		, ElementCount(0)
-	{}
-
-private:
-	std::array<GLuint, buffer::MAX> BufferName;
-	GLuint VertexArrayName;
-	GLuint PipelineName;
-	GLuint ProgramName;
-	GLsizei ElementCount;
-	typedef std::vector<vertex> vertexData;
-	vertexData VertexData;
-	std::vector<glm::uint32> ElementData;
-
-	bool initProgram()
+	template <typename vertex>
+	void generateVertices(glm::uvec2 const & GridSize, std::vector<glm::byte> & Data)
 	{
-		bool Validated = true;
-	
-		if(Validated)
-		{
-			compiler Compiler;
-			GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + (TEST == TEST_F64VEC4 ? VERT_SHADER_SOURCE_F64 : VERT_SHADER_SOURCE_F32));
-			GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
-
-			ProgramName = glCreateProgram();
-			glProgramParameteri(this->ProgramName, GL_PROGRAM_SEPARABLE, GL_TRUE);
-			glAttachShader(this->ProgramName, VertShaderName);
-			glAttachShader(this->ProgramName, FragShaderName);
-			glLinkProgram(this->ProgramName);
-
-			Validated = Validated && Compiler.check();
-			Validated = Validated && Compiler.checkProgram(this->ProgramName);
-		}
+		Data.resize(GridSize.x * GridSize.y * 4 * sizeof(vertex));
+		vertex* Vertices = reinterpret_cast<vertex*>(&Data[0]);
 
-		if(Validated)
+		for(glm::uint32 j = 0; j < GridSize.y >> 1; ++j)
+		for(glm::uint32 i = 0; i < GridSize.x >> 1; ++i)
 		{
-			glGenProgramPipelines(1, &this->PipelineName);
-			glUseProgramStages(this->PipelineName, GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT, this->ProgramName);
+			glm::uint32 Index(i + j * (GridSize.x >> 1));
+			Vertices[Index * 4 + 0] = vertex(glm::vec2(i * 2 + 0, j * 2 + 0));
+			Vertices[Index * 4 + 1] = vertex(glm::vec2(i * 2 + 2, j * 2 + 0));
+			Vertices[Index * 4 + 2] = vertex(glm::vec2(i * 2 + 2, j * 2 + 2));
+			Vertices[Index * 4 + 3] = vertex(glm::vec2(i * 2 + 0, j * 2 + 2));
 		}
-
-		return Validated;
 	}
+}//namespace
 
-	bool initBuffer()
-	{
-		glm::uvec2 const WindowSize = glm::uvec2(this->getWindowSize()) * glm::uvec2(4);
-
-		std::size_t Size = sizeof(vertex);
-		VertexData.resize(WindowSize.x * WindowSize.y * 4);
-		ElementData.resize(WindowSize.x * WindowSize.y * 6);
-		this->ElementCount = static_cast<GLsizei>(ElementData.size());
-
-		for(glm::uint32 j = 0; j < WindowSize.y >> 1; ++j)
-		for(glm::uint32 i = 0; i < WindowSize.x >> 1; ++i)
-		{
-			glm::uint32 Index(i + j * (static_cast<glm::uint32>(WindowSize.x) >> 1));
-			VertexData[Index * 4 + 0] = vertex(glm::vec2(i * 2 + 0, j * 2 + 0));
-			VertexData[Index * 4 + 1] = vertex(glm::vec2(i * 2 + 2, j * 2 + 0));
-			VertexData[Index * 4 + 2] = vertex(glm::vec2(i * 2 + 2, j * 2 + 2));
-			VertexData[Index * 4 + 3] = vertex(glm::vec2(i * 2 + 0, j * 2 + 2));
-			ElementData[Index * 6 + 0] = Index * 4 + 0;
-			ElementData[Index * 6 + 1] = Index * 4 + 1;
-			ElementData[Index * 6 + 2] = Index * 4 + 2;
-			ElementData[Index * 6 + 3] = Index * 4 + 2;
-			ElementData[Index * 6 + 4] = Index * 4 + 3;
-			ElementData[Index * 6 + 5] = Index * 4 + 0;
-		}
-
-		glm::mat4 Perspective = glm::ortho(0.0f, static_cast<float>(WindowSize.x), 0.0f, static_cast<float>(WindowSize.y));
-
-		glGenBuffers(buffer::MAX, &BufferName[0]);
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, BufferName[buffer::ELEMENT]);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, ElementData.size() * sizeof(glm::uint32), &ElementData[0], GL_STATIC_DRAW);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+test_buffer::test_buffer(int argc, char* argv[], std::size_t FrameCount, glm::uvec2 const & WindowSize, vertexFormat VertexFormat) :
+	test(argc, argv, "test_buffer", test::CORE, VertexFormat == F64VEC4 ? 4 : 3, 3, FrameCount, RUN_ONLY, WindowSize),
+	VertexFormat(VertexFormat),
+	VertexArrayName(0),
+	PipelineName(0),
+	ProgramName(0),
+	ElementCount(0)
+{
+	assert(VertexFormat < VERTEX_FORMAT_MAX);
 
-		glBindBuffer(GL_ARRAY_BUFFER, BufferName[buffer::VERTEX]);
-		glBufferData(GL_ARRAY_BUFFER, VertexData.size() * sizeof(vertex), &this->VertexData[0], GL_STATIC_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	this->BufferName.fill(0);
+}
 
-		glBindBuffer(GL_UNIFORM_BUFFER, BufferName[buffer::TRANSFORM]);
-		glBufferData(GL_UNIFORM_BUFFER, sizeof(Perspective), &Perspective[0][0], GL_STATIC_DRAW);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+bool test_buffer::initProgram()
+{
+	bool Validated = true;
 
-		return true;
+	if(Validated)
+	{
+		compiler Compiler;
+		GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + (this->VertexFormat == F64VEC4 ? VERT_SHADER_SOURCE_F64 : VERT_SHADER_SOURCE_F32));
+		GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+
+		this->ProgramName = glCreateProgram();
+		glProgramParameteri(this->ProgramName, GL_PROGRAM_SEPARABLE, GL_TRUE);
+		glAttachShader(this->ProgramName, VertShaderName);
+		glAttachShader(this->ProgramName, FragShaderName);
+		glLinkProgram(this->ProgramName);
+
+		Validated = Validated && Compiler.check();
+		Validated = Validated && Compiler.checkProgram(this->ProgramName);
 	}
 
-	bool initVertexArray()
+	if(Validated)
 	{
-		glGenVertexArrays(1, &VertexArrayName);
-		glBindVertexArray(VertexArrayName);
-			glBindBuffer(GL_ARRAY_BUFFER, BufferName[buffer::VERTEX]);
-			for (std::size_t i = 0; i < sizeof(Attribs) / sizeof(attrib); ++i)
-			{
-				if(Attribs[i].Type == GL_DOUBLE)
-					glVertexAttribLPointer(static_cast<GLuint>(i), Attribs[i].Size, Attribs[i].Type, sizeof(vertex), Attribs[i].Offset);
-				else
-					glVertexAttribPointer(static_cast<GLuint>(i), Attribs[i].Size, Attribs[i].Type, Attribs[i].Normalized, sizeof(vertex), Attribs[i].Offset);
-				glEnableVertexAttribArray(static_cast<GLuint>(i));
-			}
-			glBindBuffer(GL_ARRAY_BUFFER, 0);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, BufferName[buffer::ELEMENT]);
-		glBindVertexArray(0);
-
-		return true;
+		glGenProgramPipelines(1, &this->PipelineName);
+		glUseProgramStages(this->PipelineName, GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT, this->ProgramName);
 	}
 
-	bool init()
+	return Validated;
+}
+
+bool test_buffer::initBuffer()
+{
+	glm::uvec2 const WindowSize = glm::uvec2(this->getWindowSize()) * glm::uvec2(4);
+
+	switch(this->VertexFormat)
 	{
-		bool Validated = true;
-		if(Validated)
-			Validated = initBuffer();
-		if(Validated)
-			Validated = initVertexArray();
-		if(Validated)
-			Validated = initProgram();
-		return Validated;
+	case U8VEC4:
+		generateVertices<vertex_u8color4>(WindowSize, this->VertexData);
+		break;
+	case F16VEC4:
+		generateVertices<vertex_f16color4>(WindowSize, this->VertexData);
+		break;
+	case F16VEC3:
+		generateVertices<vertex_f16color3>(WindowSize, this->VertexData);
+		break;
+	case F32VEC4:
+		generateVertices<vertex_f32color4>(WindowSize, this->VertexData);
+		break;
+	default:
+		generateVertices<vertex_f64color4>(WindowSize, this->VertexData);
+		break;
 	}
 
-	bool begin()
+	this->ElementData.resize(WindowSize.x * WindowSize.y * 6);
+	this->ElementCount = static_cast<GLsizei>(this->ElementData.size());
+
+	for(glm::uint32 j = 0; j < WindowSize.y >> 1; ++j)
+	for(glm::uint32 i = 0; i < WindowSize.x >> 1; ++i)
 	{
-		bool Validated = this->init();
+		glm::uint32 Index(i + j * (static_cast<glm::uint32>(WindowSize.x) >> 1));
+		this->ElementData[Index * 6 + 0] = Index * 4 + 0;
+		this->ElementData[Index * 6 + 1] = Index * 4 + 1;
+		this->ElementData[Index * 6 + 2] = Index * 4 + 2;
+		this->ElementData[Index * 6 + 3] = Index * 4 + 2;
+		this->ElementData[Index * 6 + 4] = Index * 4 + 3;
+		this->ElementData[Index * 6 + 5] = Index * 4 + 0;
+	}
 
-		if(Validated)
-		{
-			glm::vec2 WindowSize(this->getWindowSize());
-			glViewportIndexedf(0, 0, 0, WindowSize.x, WindowSize.y);
+	glm::mat4 Perspective = glm::ortho(0.0f, static_cast<float>(WindowSize.x), 0.0f, static_cast<float>(WindowSize.y));
 
-			glBindProgramPipeline(this->PipelineName);
-			glBindVertexArray(this->VertexArrayName);
-			glBindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, this->BufferName[buffer::TRANSFORM]);
-			glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.5f, 1.0f, 1.0f)[0]);
+	glGenBuffers(BUFFER_MAX, &this->BufferName[0]);
 
-			//glEnable(GL_DEPTH_TEST);
-			//glDepthFunc(GL_LESS);
-		}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->BufferName[BUFFER_ELEMENT]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->ElementData.size() * sizeof(glm::uint32), &this->ElementData[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
-		return Validated;
-	}
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+	glBufferData(GL_ARRAY_BUFFER, this->VertexData.size(), &this->VertexData[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-	bool end()
-	{
-		glDeleteBuffers(buffer::MAX, &this->BufferName[0]);
-		glDeleteProgramPipelines(1, &this->PipelineName);
-		glDeleteProgram(this->ProgramName);
-		glDeleteVertexArrays(1, &this->VertexArrayName);
+	glBindBuffer(GL_UNIFORM_BUFFER, this->BufferName[BUFFER_TRANSFORM]);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(Perspective), &Perspective[0][0], GL_STATIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
-		return true;
-	}
+	return true;
+}
 
-	bool render()
-	{
-		glm::uvec2 const WindowSize(this->getWindowSize());
-/*
-		for(std::size_t j = 0; j < WindowSize.y >> 1; ++j)
-		for(std::size_t i = 0; i < WindowSize.x >> 1; ++i)
+bool test_buffer::initVertexArray()
+{
+	vertexFormatInfo const & Format = Formats[this->VertexFormat];
+	GLsizei const Stride = static_cast<GLsizei>(Format.VertexSize);
+
+	glGenVertexArrays(1, &this->VertexArrayName);
+	glBindVertexArray(this->VertexArrayName);
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, Stride, BUFFER_OFFSET(0));
+		glEnableVertexAttribArray(0);
+		for(std::size_t i = 1; i < AttribCount; ++i)
 		{
-			std::size_t Index(i + j * (static_cast<std::size_t>(WindowSize.x) >> 1));
-			VertexData[Index * 4 + 0] = vertex(glm::vec3(i * 2 + 0, j * 2 + 0, 0), this->generateColorU8(), this->generateColor(), this->generateColor(), this->generateColor());
-			VertexData[Index * 4 + 1] = vertex(glm::vec3(i * 2 + 2, j * 2 + 0, 0), this->generateColorU8(), this->generateColor(), this->generateColor(), this->generateColor());
-			VertexData[Index * 4 + 2] = vertex(glm::vec3(i * 2 + 2, j * 2 + 2, 0), this->generateColorU8(), this->generateColor(), this->generateColor(), this->generateColor());
-			VertexData[Index * 4 + 3] = vertex(glm::vec3(i * 2 + 0, j * 2 + 2, 0), this->generateColorU8(), this->generateColor(), this->generateColor(), this->generateColor());
-			ElementData[Index * 6 + 0] = Index * 4 + 0;
-			ElementData[Index * 6 + 1] = Index * 4 + 1;
-			ElementData[Index * 6 + 2] = Index * 4 + 2;
-			ElementData[Index * 6 + 3] = Index * 4 + 2;
-			ElementData[Index * 6 + 4] = Index * 4 + 3;
-			ElementData[Index * 6 + 5] = Index * 4 + 0;
+			GLvoid const * Offset = BUFFER_OFFSET(sizeof(glm::vec2) + Format.ColorSize * (i - 1));
+			if(Format.Type == GL_DOUBLE)
+				glVertexAttribLPointer(static_cast<GLuint>(i), Format.Size, Format.Type, Stride, Offset);
+			else
+				glVertexAttribPointer(static_cast<GLuint>(i), Format.Size, Format.Type, Format.Normalized, Stride, Offset);
+			glEnableVertexAttribArray(static_cast<GLuint>(i));
 		}
-*/
-		this->beginTimer();
-			glDrawElementsInstanced(GL_TRIANGLES, this->ElementCount, GL_UNSIGNED_INT, 0, 1);
-		this->endTimer();
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->BufferName[BUFFER_ELEMENT]);
+	glBindVertexArray(0);
 
-		return true;
-	}
-};
+	return true;
+}
 
-struct entry
-{
-	entry(
-		std::string const & String,
-		glm::uvec2 const & WindowSize,
-		glm::vec2 const & TileSize,
-		std::size_t const & TrianglePairPerTile,
-		std::size_t const & DrawPerTile
-	) :
-		String(String),
-		WindowSize(WindowSize),
-		TileSize(TileSize),
-		TrianglePairPerTile(TrianglePairPerTile),
-		DrawPerTile(DrawPerTile)
-	{}
-
-	std::string const String;
-	glm::uvec2 const WindowSize;
-	glm::vec2 const TileSize;
-	std::size_t const TrianglePairPerTile;
-	std::size_t const DrawPerTile;
-};
-
-int main_buffer(int argc, char* argv[])
+bool test_buffer::begin()
 {
-	std::vector<entry> Entries;
-
-	for(glm::uint TileSizeIndex = 3; TileSizeIndex < 4; ++TileSizeIndex)
-	{	
-		for(std::size_t DrawPerTile = 1; DrawPerTile <= 512; DrawPerTile <<= 1)
-			Entries.push_back(entry(
-				message_format("window(%d), tile(%d), triangle-per-draw(%d)", 64 * (TileSizeIndex + 1), 8 * (TileSizeIndex + 1), 1024 / DrawPerTile),
-				glm::uvec2(64) * (TileSizeIndex + 1), glm::vec2(glm::uvec2(8, 8) * (TileSizeIndex + 1)), 512, DrawPerTile));
+	bool Validated = true;
+	if(Validated)
+		Validated = this->initBuffer();
+	if(Validated)
+		Validated = this->initVertexArray();
+	if(Validated)
+		Validated = this->initProgram();
+
+	if(Validated)
+	{
+		glm::vec2 WindowSize(this->getWindowSize());
+		glViewportIndexedf(0, 0, 0, WindowSize.x, WindowSize.y);
+
+		glBindProgramPipeline(this->PipelineName);
+		glBindVertexArray(this->VertexArrayName);
+		glBindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, this->BufferName[BUFFER_TRANSFORM]);
+		glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.5f, 1.0f, 1.0f)[0]);
 	}
 
-	csv CSV;
-	int Error(0);
+	return Validated;
+}
 
-	test_buffer Test(argc, argv, 10000, glm::uvec2(256));
+bool test_buffer::end()
+{
+	glDeleteBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glDeleteProgramPipelines(1, &this->PipelineName);
+	glDeleteProgram(this->ProgramName);
+	glDeleteVertexArrays(1, &this->VertexArrayName);
 
-	Error += Test();
-	Test.log(CSV, "GNI");
+	return true;
+}
 
-	CSV.save("../main_buffer.csv");
+bool test_buffer::render()
+{
+	this->beginTimer();
+		glDrawElementsInstanced(GL_TRIANGLES, this->ElementCount, GL_UNSIGNED_INT, 0, 1);
+	this->endTimer();
 
-	return Error;
+	return true;
 }
-
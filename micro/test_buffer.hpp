@@ -1,3 +1,47 @@
 #pragma once
 
-int main_buffer(int argc, char* argv[]);
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Draws a grid of quads which vertices carry twelve colors encoded with the vertex format
+class test_buffer : public test
+{
+public:
+	enum vertexFormat
+	{
+		U8VEC4,
+		F16VEC4,
+		F16VEC3,
+		F32VEC4,
+		F64VEC4,
+		VERTEX_FORMAT_MAX
+	};
+
+	test_buffer(int argc, char* argv[], std::size_t FrameCount, glm::uvec2 const & WindowSize, vertexFormat VertexFormat);
+
+private:
+	enum buffer
+	{
+		BUFFER_VERTEX,
+		BUFFER_ELEMENT,
+		BUFFER_TRANSFORM,
+		BUFFER_MAX
+	};
+
+	bool initProgram();
+	bool initBuffer();
+	bool initVertexArray();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+	vertexFormat const VertexFormat;
+	std::array<GLuint, BUFFER_MAX> BufferName;
+	GLuint VertexArrayName;
+	GLuint PipelineName;
+	GLuint ProgramName;
+	GLsizei ElementCount;
+	std::vector<glm::byte> VertexData;
+	std::vector<glm::uint32> ElementData;
+};
@@ -0,0 +1,267 @@
+#include "test_buffer_streaming.hpp"
+#include <cstring>
+
+namespace
+{
+	char const * VERT_SHADER_SOURCE("micro/test_buffer_streaming.vert");
+	char const * FRAG_SHADER_SOURCE("micro/test_buffer_streaming.frag");
+
+	// GL_AMD_pinned_memory requires page aligned client memory
+	std::size_t const PAGE_SIZE(4096);
+
+	// Outside of the clip volume so that no fragment is generated
+	glm::vec4 const CLIPPED_POSITION(2.0f, 2.0f, 2.0f, 1.0f);
+}//namespace
+
+testBufferStreaming::testBufferStreaming(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	strategy Strategy, target Target, std::size_t UploadSize
+) :
+	test(argc, argv, "testBufferStreaming", Profile, 4, 3, FrameCount),
+	Strategy(Strategy),
+	Target(Target),
+	UploadSize((UploadSize + UNIFORM_CHUNK_SIZE - 1) / UNIFORM_CHUNK_SIZE * UNIFORM_CHUNK_SIZE),
+	PinnedAddress(nullptr),
+	FrameIndex(0),
+	BufferName(0),
+	ProgramName(0),
+	VertexArrayName(0)
+{
+	assert(UploadSize > 0);
+
+	this->Fences.fill(0);
+}
+
+testBufferStreaming::~testBufferStreaming()
+{}
+
+bool testBufferStreaming::begin()
+{
+	bool Validated = true;
+
+	if(this->Strategy == PERSISTENT_COHERENT || this->Strategy == PERSISTENT_FLUSH)
+		Validated = Validated && this->checkExtension("GL_ARB_buffer_storage");
+	if(this->Strategy == PINNED_AMD)
+		Validated = Validated && this->checkExtension("GL_AMD_pinned_memory");
+
+	if(Validated)
+		Validated = this->initProgram();
+	if(Validated)
+		Validated = this->initBuffer();
+	if(Validated)
+		Validated = this->initVertexArray();
+
+	if(Validated)
+	{
+		glm::vec2 const WindowSize(this->getWindowSize());
+		glViewportIndexedf(0, 0, 0, WindowSize.x, WindowSize.y);
+		glUseProgram(this->ProgramName);
+		glBindVertexArray(this->VertexArrayName);
+	}
+
+	return Validated && this->checkError("begin");
+}
+
+bool testBufferStreaming::end()
+{
+	// The pinned memory must outlive the GL commands reading it
+	glFinish();
+
+	for(std::size_t FrameIndex = 0; FrameIndex < FRAME_COUNT; ++FrameIndex)
+		if(this->Fences[FrameIndex])
+			glDeleteSync(this->Fences[FrameIndex]);
+	this->Fences.fill(0);
+
+	this->Ring.reset();
+	glDeleteBuffers(1, &this->BufferName);
+	glDeleteVertexArrays(1, &this->VertexArrayName);
+	glDeleteProgram(this->ProgramName);
+
+	return true;
+}
+
+bool testBufferStreaming::initProgram()
+{
+	compiler Compiler;
+	GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE,
+		this->Target == UNIFORM_DATA ? "--define UNIFORM_DATA" : "");
+	GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+
+	this->ProgramName = glCreateProgram();
+	glAttachShader(this->ProgramName, VertShaderName);
+	glAttachShader(this->ProgramName, FragShaderName);
+	glLinkProgram(this->ProgramName);
+
+	bool Validated = Compiler.check();
+	Validated = Validated && Compiler.checkProgram(this->ProgramName);
+
+	return Validated;
+}
+
+bool testBufferStreaming::initBuffer()
+{
+	this->Data.resize(this->UploadSize / sizeof(glm::vec4), CLIPPED_POSITION);
+
+	switch(this->Strategy)
+	{
+	case PERSISTENT_COHERENT:
+	case PERSISTENT_FLUSH:
+	{
+		GLint Alignment = static_cast<GLint>(sizeof(glm::vec4));
+		if(this->Target == UNIFORM_DATA)
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &Alignment);
+
+		std::uint32_t const Flags = this->Strategy == PERSISTENT_COHERENT ? gl::buffer::COHERENT_BIT : 0;
+		this->Ring.reset(new gl::ring(this->UploadSize * FRAME_COUNT, static_cast<std::size_t>(Alignment), Flags));
+		return this->Ring->isValid();
+	}
+	case PINNED_AMD:
+	{
+		std::size_t const Size = this->UploadSize * FRAME_COUNT;
+		this->PinnedMemory.reset(new glm::byte[Size + PAGE_SIZE - 1]);
+		std::uintptr_t const Address = reinterpret_cast<std::uintptr_t>(this->PinnedMemory.get());
+		this->PinnedAddress = reinterpret_cast<glm::byte*>((Address + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE);
+
+		glGenBuffers(1, &this->BufferName);
+		glBindBuffer(GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD, this->BufferName);
+		glBufferData(GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD, Size, this->PinnedAddress, GL_STREAM_COPY);
+		glBindBuffer(GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD, 0);
+		return true;
+	}
+	default:
+	{
+		std::size_t const Size = this->Strategy == MAP_UNSYNCHRONIZED ? this->UploadSize * FRAME_COUNT : this->UploadSize;
+
+		glGenBuffers(1, &this->BufferName);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->BufferName);
+		glBufferData(GL_COPY_WRITE_BUFFER, Size, nullptr, GL_STREAM_DRAW);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		return true;
+	}
+	}
+}
+
+bool testBufferStreaming::initVertexArray()
+{
+	glGenVertexArrays(1, &this->VertexArrayName);
+	glBindVertexArray(this->VertexArrayName);
+	if(this->Target == VERTEX_DATA)
+	{
+		glVertexAttribFormat(semantic::attr::POSITION, 4, GL_FLOAT, GL_FALSE, 0);
+		glVertexAttribBinding(semantic::attr::POSITION, 0);
+		glEnableVertexAttribArray(semantic::attr::POSITION);
+	}
+	glBindVertexArray(0);
+
+	return true;
+}
+
+void testBufferStreaming::waitFrame(std::size_t FrameIndex)
+{
+	GLsync & Fence = this->Fences[FrameIndex];
+	if(!Fence)
+		return;
+
+	while(glClientWaitSync(Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED){}
+	glDeleteSync(Fence);
+	Fence = 0;
+}
+
+std::uintptr_t testBufferStreaming::upload()
+{
+	std::size_t const Region = this->FrameIndex % FRAME_COUNT;
+	void const * Source = &this->Data[0];
+
+	switch(this->Strategy)
+	{
+	case ORPHAN:
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->BufferName);
+		glBufferData(GL_COPY_WRITE_BUFFER, this->UploadSize, Source, GL_STREAM_DRAW);
+		return 0;
+	case SUB_DATA:
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->BufferName);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, 0, this->UploadSize, Source);
+		return 0;
+	case MAP_INVALIDATE:
+	{
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->BufferName);
+		void* Pointer = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, this->UploadSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if(Pointer)
+			memcpy(Pointer, Source, this->UploadSize);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		return 0;
+	}
+	case MAP_UNSYNCHRONIZED:
+	{
+		this->waitFrame(Region);
+
+		std::uintptr_t const Offset = Region * this->UploadSize;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, this->BufferName);
+		void* Pointer = glMapBufferRange(GL_COPY_WRITE_BUFFER, Offset, this->UploadSize,
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		if(Pointer)
+			memcpy(Pointer, Source, this->UploadSize);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		return Offset;
+	}
+	case PERSISTENT_COHERENT:
+	case PERSISTENT_FLUSH:
+	{
+		gl::ring::allocation const Allocation = this->Ring->allocate(this->UploadSize);
+		if(Allocation.Pointer)
+			memcpy(Allocation.Pointer, Source, this->UploadSize);
+		this->Ring->flush(Allocation);
+		return Allocation.Offset;
+	}
+	default:
+	{
+		this->waitFrame(Region);
+
+		std::uintptr_t const Offset = Region * this->UploadSize;
+		memcpy(this->PinnedAddress + Offset, Source, this->UploadSize);
+		return Offset;
+	}
+	}
+}
+
+void testBufferStreaming::draw(std::uintptr_t Offset)
+{
+	GLuint const BufferName = this->Ring ? this->Ring->name() : this->BufferName;
+
+	if(this->Target == VERTEX_DATA)
+	{
+		glBindVertexBuffer(0, BufferName, static_cast<GLintptr>(Offset), sizeof(glm::vec4));
+		glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(this->Data.size()));
+		this->addDrawCount(1);
+		return;
+	}
+
+	std::size_t const ChunkCount = this->UploadSize / UNIFORM_CHUNK_SIZE;
+	for(std::size_t ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		glBindBufferRange(GL_UNIFORM_BUFFER, semantic::uniform::MATERIAL, BufferName,
+			static_cast<GLintptr>(Offset + ChunkIndex * UNIFORM_CHUNK_SIZE), UNIFORM_CHUNK_SIZE);
+		glDrawArrays(GL_POINTS, 0, UNIFORM_CHUNK_SIZE / sizeof(glm::vec4));
+	}
+	this->addDrawCount(ChunkCount);
+}
+
+bool testBufferStreaming::render()
+{
+	std::size_t const Region = this->FrameIndex % FRAME_COUNT;
+
+	this->beginTimer();
+		std::uintptr_t const Offset = this->upload();
+		this->draw(Offset);
+
+		if(this->Ring)
+			this->Ring->fence();
+		else if(this->Strategy == MAP_UNSYNCHRONIZED || this->Strategy == PINNED_AMD)
+			this->Fences[Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	this->endTimer();
+
+	this->addUploadSize(this->UploadSize);
+	++this->FrameIndex;
+
+	return true;
+}
@@ -0,0 +1,83 @@
+#ifndef TEST_BUFFER_STREAMING_INCLUDED
+#define TEST_BUFFER_STREAMING_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+#include "buffer.hpp"
+
+// Each frame writes UploadSize bytes of new vertex or uniform data then draws one point per vec4 of it.
+// The points are clipped, only the upload and the vertex fetch or uniform reads are measured.
+class testBufferStreaming : public test
+{
+public:
+	enum strategy
+	{
+		// glBufferData with the new data, the driver orphans the previous storage
+		ORPHAN,
+		// glBufferSubData in place, implicitly synchronized with the previous frame draws
+		SUB_DATA,
+		// glMapBufferRange with GL_MAP_INVALIDATE_BUFFER_BIT
+		MAP_INVALIDATE,
+		// glMapBufferRange with GL_MAP_UNSYNCHRONIZED_BIT in a ring of frames guarded by fences
+		MAP_UNSYNCHRONIZED,
+		// gl::ring over a persistent coherent mapping
+		PERSISTENT_COHERENT,
+		// gl::ring over a persistent mapping flushed explicitly
+		PERSISTENT_FLUSH,
+		// Client memory used by GL through GL_AMD_pinned_memory, in a ring of frames guarded by fences
+		PINNED_AMD,
+		STRATEGY_MAX
+	};
+
+	enum target
+	{
+		VERTEX_DATA,
+		// Read by chunks of UNIFORM_CHUNK_SIZE bytes, one draw per chunk
+		UNIFORM_DATA,
+		TARGET_MAX
+	};
+
+public:
+	testBufferStreaming(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		strategy Strategy, target Target, std::size_t UploadSize);
+	virtual ~testBufferStreaming();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	enum
+	{
+		// Frames in flight for the strategies managing their own synchronization
+		FRAME_COUNT = 3,
+		// The minimum GL_MAX_UNIFORM_BLOCK_SIZE
+		UNIFORM_CHUNK_SIZE = 16384
+	};
+
+	bool initProgram();
+	bool initBuffer();
+	bool initVertexArray();
+
+	// Writes the frame data and returns its offset in the buffer bound by draw()
+	std::uintptr_t upload();
+	void draw(std::uintptr_t Offset);
+	// Wait until the GL commands reading the frame region of the buffer are completed
+	void waitFrame(std::size_t FrameIndex);
+
+	strategy const Strategy;
+	target const Target;
+	std::size_t const UploadSize;
+	std::vector<glm::vec4> Data;
+	std::unique_ptr<gl::ring> Ring;
+	std::unique_ptr<glm::byte[]> PinnedMemory;
+	glm::byte* PinnedAddress;
+	std::array<GLsync, FRAME_COUNT> Fences;
+	std::size_t FrameIndex;
+	GLuint BufferName;
+	GLuint ProgramName;
+	GLuint VertexArrayName;
+};
+
+#endif//TEST_BUFFER_STREAMING_INCLUDED
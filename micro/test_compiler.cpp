@@ -1,5 +1,7 @@
 #include "test_compiler.hpp"
 #include <array>
+#include <chrono>
+#include <thread>
 
 namespace
 {
@@ -17,8 +19,9 @@ namespace
 testCompiler::testCompiler(
 	int argc, char* argv[], profile Profile, std::size_t FrameCount, mode Mode
 ) :
-	test(argc, argv, "testCompiler", Profile, 4, 2),
-	Mode(Mode)
+	test(argc, argv, "testCompiler", Profile, 4, 2, FrameCount),
+	Mode(Mode),
+	FrameIndex(0)
 {}
 
 testCompiler::~testCompiler()
@@ -39,12 +42,12 @@ bool testCompiler::begin()
 	VertShaderFile.push_back("gl-320/draw-without-vertex-attrib.vert");
 	VertShaderFile.push_back("gl-320/texture-3d.vert");
 	VertShaderFile.push_back("gl-330/texture-rect.vert");
-	VertShaderFile.push_back("hz-430/vertex-array-object.vert");
-	VertShaderFile.push_back("hz-430/screenspace_coherence.vert");
-	VertShaderFile.push_back("hz-430/multi-draw-indirect.vert");
-	VertShaderFile.push_back("hz-430/draw-uniform2.vert");
-	VertShaderFile.push_back("hz-430/draw-uniform.vert");
-	VertShaderFile.push_back("hz-430/draw-range.vert");
+	VertShaderFile.push_back("micro/vertex-array-object.vert");
+	VertShaderFile.push_back("micro/screenspace_coherence.vert");
+	VertShaderFile.push_back("micro/multi-draw-indirect.vert");
+	VertShaderFile.push_back("micro/draw-uniform2.vert");
+	VertShaderFile.push_back("micro/draw-uniform.vert");
+	VertShaderFile.push_back("micro/draw-range.vert");
 	VertShaderName.resize(VertShaderFile.size());
 
 	FragShaderFile.push_back("gl-320/texture-offset-bicubic.frag");
@@ -58,16 +61,34 @@ bool testCompiler::begin()
 	FragShaderFile.push_back("gl-320/draw-without-vertex-attrib.frag");
 	FragShaderFile.push_back("gl-320/texture-3d.frag");
 	FragShaderFile.push_back("gl-330/texture-rect.frag");
-	FragShaderFile.push_back("hz-430/vertex-array-object.frag");
-	FragShaderFile.push_back("hz-430/screenspace_coherence.frag");
-	FragShaderFile.push_back("hz-430/multi-draw-indirect.frag");
-	FragShaderFile.push_back("hz-430/draw-uniform2.frag");
-	FragShaderFile.push_back("hz-430/draw-uniform.frag");
-	FragShaderFile.push_back("hz-430/draw-range.frag");
+	FragShaderFile.push_back("micro/vertex-array-object.frag");
+	FragShaderFile.push_back("micro/screenspace_coherence.frag");
+	FragShaderFile.push_back("micro/multi-draw-indirect.frag");
+	FragShaderFile.push_back("micro/draw-uniform2.frag");
+	FragShaderFile.push_back("micro/draw-uniform.frag");
+	FragShaderFile.push_back("micro/draw-range.frag");
 	FragShaderName.resize(FragShaderFile.size());
 
 	ProgramName.resize(FragShaderFile.size());
 
+	// The first frame misses the program cache, the following ones hit it
+	if(this->Mode == PROGRAM_CACHE)
+	{
+		compiler Compiler;
+		Compiler.setProgramCache(true);
+		for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+		{
+			GLuint const VertName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VertShaderFile[ProgramIndex], "--version 420 --profile core");
+			GLuint const FragName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FragShaderFile[ProgramIndex], "--version 420 --profile core");
+
+			GLuint const Name = glCreateProgram();
+			glAttachShader(Name, VertName);
+			glAttachShader(Name, FragName);
+			Compiler.evictProgramCache(Name);
+			glDeleteProgram(Name);
+		}
+	}
+
 	return Success;
 }
 
@@ -79,11 +100,51 @@ bool testCompiler::end()
 bool testCompiler::render()
 {
 	compiler Compiler;
+	Compiler.setProgramCache(this->Mode == PROGRAM_CACHE);
 
-	this->beginTimer();
+	// Compilation latency is CPU side, the GPU timer would only measure the glUseProgram calls
+	std::chrono::high_resolution_clock::time_point const TimeBegin = std::chrono::high_resolution_clock::now();
 
 	switch(this->Mode)
 	{
+		case BATCHED:
+		{
+			std::vector<compiler::shader> Shaders;
+			for(std::size_t ShaderIndex = 0; ShaderIndex < VertShaderFile.size(); ++ShaderIndex)
+			{
+				Shaders.push_back(compiler::shader(GL_VERTEX_SHADER, getDataDirectory() + VertShaderFile[ShaderIndex], "--version 420 --profile core"));
+				Shaders.push_back(compiler::shader(GL_FRAGMENT_SHADER, getDataDirectory() + FragShaderFile[ShaderIndex], "--version 420 --profile core"));
+			}
+
+			std::vector<GLuint> const ShaderName = Compiler.create(Shaders);
+			for(std::size_t ShaderIndex = 0; ShaderIndex < VertShaderFile.size(); ++ShaderIndex)
+			{
+				VertShaderName[ShaderIndex] = ShaderName[ShaderIndex * 2 + 0];
+				FragShaderName[ShaderIndex] = ShaderName[ShaderIndex * 2 + 1];
+			}
+
+			for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+			{
+				ProgramName[ProgramIndex] = glCreateProgram();
+				glAttachShader(ProgramName[ProgramIndex], VertShaderName[ProgramIndex]);
+				glAttachShader(ProgramName[ProgramIndex], FragShaderName[ProgramIndex]);
+				glLinkProgram(ProgramName[ProgramIndex]);
+			}
+
+			// Poll without blocking, a sample would do other work meanwhile
+			while(!Compiler.isCompleted())
+				std::this_thread::yield();
+			for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+			{
+				while(!Compiler.isProgramCompleted(ProgramName[ProgramIndex]))
+					std::this_thread::yield();
+			}
+
+			Compiler.check();
+			for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+				Compiler.checkProgram(ProgramName[ProgramIndex]);
+		}
+		break;
 		case MULTITHREADED:
 		{
 			for(std::size_t ShaderIndex = 0; ShaderIndex < VertShaderFile.size(); ++ShaderIndex)
@@ -124,6 +185,26 @@ bool testCompiler::render()
 			}
 		}
 		break;
+		case PROGRAM_CACHE:
+		{
+			std::size_t HitCount = 0;
+			for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+			{
+				VertShaderName[ProgramIndex] = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VertShaderFile[ProgramIndex], "--version 420 --profile core");
+				FragShaderName[ProgramIndex] = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FragShaderFile[ProgramIndex], "--version 420 --profile core");
+
+				ProgramName[ProgramIndex] = glCreateProgram();
+				glAttachShader(ProgramName[ProgramIndex], VertShaderName[ProgramIndex]);
+				glAttachShader(ProgramName[ProgramIndex], FragShaderName[ProgramIndex]);
+				if(Compiler.link(ProgramName[ProgramIndex]))
+					++HitCount;
+				else
+					Compiler.check();
+				Compiler.checkProgram(ProgramName[ProgramIndex]);
+			}
+			this->addSample("program cache hits", static_cast<double>(HitCount), false);
+		}
+		break;
 		case SINGLETHREADED:
 		{
 			for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
@@ -142,10 +223,23 @@ bool testCompiler::render()
 		break;
 	}
 
+	// Delete the VertShaderName and FragShaderName shaders of every mode once linked and checked, the programs
+	// keep them alive until they are deleted at the end of the frame so that no frame accumulates shader objects
+	Compiler.clear();
+
 	for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
 		glUseProgram(ProgramName[ProgramIndex]);
 
-	this->endTimer();
+	std::chrono::high_resolution_clock::time_point const TimeEnd = std::chrono::high_resolution_clock::now();
+	double const Time = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(TimeEnd - TimeBegin).count());
+	this->addTimeSample(Time);
+	if(this->Mode == PROGRAM_CACHE)
+		this->addSample(this->FrameIndex == 0 ? "cold" : "warm", Time);
+	++this->FrameIndex;
+
+	glUseProgram(0);
+	for(std::size_t ProgramIndex = 0; ProgramIndex < ProgramName.size(); ++ProgramIndex)
+		glDeleteProgram(ProgramName[ProgramIndex]);
 
 	return true;
 }
@@ -2,6 +2,7 @@
 #define TEST_COMPILER_INCLUDED
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 
 class testCompiler : public test
 {
@@ -11,6 +12,8 @@ public:
 		MULTITHREADED,
 		DUALTHREADED,
 		SINGLETHREADED,
+		BATCHED,
+		PROGRAM_CACHE,
 		MODE_MAX
 	};
 
@@ -31,6 +34,7 @@ private:
 	std::vector<GLuint> FragShaderName;
 	std::vector<GLuint> ProgramName;
 	mode Mode;
+	std::size_t FrameIndex;
 };
 
 #endif//TEST_COMPILER_INCLUDED
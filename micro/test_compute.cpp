@@ -0,0 +1,182 @@
+#include "test_compute.hpp"
+
+namespace
+{
+	char const * COMP_SHADER_SOURCE("micro/test_compute.comp");
+
+	// Location of the InvocationCount uniform
+	GLint const INVOCATION_COUNT_LOCATION(0);
+
+	namespace semantics
+	{
+		enum type
+		{
+			INPUT = 0,
+			OUTPUT = 1
+		};
+	}//namespace semantics
+
+	char const * patternDefine(testCompute::pattern Pattern)
+	{
+		switch(Pattern)
+		{
+			case testCompute::COALESCED:
+				return "COALESCED";
+			case testCompute::STRIDED:
+				return "STRIDED";
+			case testCompute::ATOMIC:
+				return "ATOMIC";
+			case testCompute::SHARED_REDUCTION:
+				return "SHARED_REDUCTION";
+			default:
+				assert(0);
+				return "";
+		}
+	}
+}//namespace
+
+testCompute::testCompute(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	pattern Pattern, barrier Barrier, glm::uvec3 const & LocalSize, std::size_t InvocationCount, std::size_t DispatchCount
+) :
+	test(argc, argv, "testCompute", Profile, 4, 3, FrameCount),
+	Pattern(Pattern),
+	Barrier(Barrier),
+	LocalSize(LocalSize),
+	InvocationCount(InvocationCount),
+	DispatchCount(DispatchCount),
+	GroupCount(0),
+	ProgramName(0)
+{
+	assert(InvocationCount > 0 && DispatchCount > 0);
+
+	this->BufferName.fill(0);
+}
+
+testCompute::~testCompute()
+{}
+
+bool testCompute::begin()
+{
+	bool Validated = this->checkLimits();
+
+	if(Validated)
+		Validated = this->initProgram();
+	if(Validated)
+		Validated = this->initBuffer();
+
+	if(Validated)
+		glUseProgram(this->ProgramName);
+
+	return Validated && this->checkError("begin");
+}
+
+bool testCompute::end()
+{
+	glDeleteBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glDeleteProgram(this->ProgramName);
+
+	return true;
+}
+
+bool testCompute::checkLimits() const
+{
+	if(glm::any(glm::equal(this->LocalSize, glm::uvec3(0))))
+	{
+		fprintf(stderr, "LocalSize components must be greater than zero\n");
+		return false;
+	}
+
+	GLint MaxInvocations = 0;
+	glGetIntegerv(GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS, &MaxInvocations);
+	if(this->LocalSize.x * this->LocalSize.y * this->LocalSize.z > static_cast<glm::uint>(MaxInvocations))
+	{
+		fprintf(stderr, "LocalSize (%d, %d, %d) exceeds GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS %d\n",
+			this->LocalSize.x, this->LocalSize.y, this->LocalSize.z, MaxInvocations);
+		return false;
+	}
+
+	for(GLuint Dimension = 0; Dimension < 3; ++Dimension)
+	{
+		GLint MaxSize = 0;
+		glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_SIZE, Dimension, &MaxSize);
+		if(this->LocalSize[Dimension] > static_cast<glm::uint>(MaxSize))
+		{
+			fprintf(stderr, "LocalSize %d exceeds GL_MAX_COMPUTE_WORK_GROUP_SIZE %d on dimension %d\n",
+				this->LocalSize[Dimension], MaxSize, Dimension);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool testCompute::initProgram()
+{
+	std::string const Arguments = format("--define %s --define LOCAL_SIZE_X=%d --define LOCAL_SIZE_Y=%d --define LOCAL_SIZE_Z=%d",
+		patternDefine(this->Pattern), this->LocalSize.x, this->LocalSize.y, this->LocalSize.z);
+
+	compiler Compiler;
+	GLuint CompShaderName = Compiler.create(GL_COMPUTE_SHADER, getDataDirectory() + COMP_SHADER_SOURCE, Arguments);
+
+	this->ProgramName = glCreateProgram();
+	glAttachShader(this->ProgramName, CompShaderName);
+	glLinkProgram(this->ProgramName);
+
+	bool Validated = Compiler.check();
+	Validated = Validated && Compiler.checkProgram(this->ProgramName);
+
+	if(Validated)
+		glProgramUniform1ui(this->ProgramName, INVOCATION_COUNT_LOCATION, static_cast<GLuint>(this->InvocationCount));
+
+	return Validated;
+}
+
+bool testCompute::initBuffer()
+{
+	std::size_t const GroupSize = this->LocalSize.x * this->LocalSize.y * this->LocalSize.z;
+	std::size_t const Groups = (this->InvocationCount + GroupSize - 1) / GroupSize;
+
+	GLint MaxCountX = 0, MaxCountY = 0;
+	glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 0, &MaxCountX);
+	glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 1, &MaxCountY);
+
+	this->GroupCount.x = static_cast<glm::uint>(glm::min<std::size_t>(Groups, static_cast<std::size_t>(MaxCountX)));
+	this->GroupCount.y = static_cast<glm::uint>((Groups + this->GroupCount.x - 1) / this->GroupCount.x);
+	if(this->GroupCount.y > static_cast<glm::uint>(MaxCountY))
+	{
+		fprintf(stderr, "InvocationCount %d requires more than GL_MAX_COMPUTE_WORK_GROUP_COUNT work groups\n", static_cast<int>(this->InvocationCount));
+		return false;
+	}
+
+	std::vector<glm::uint> Data(this->InvocationCount, 1);
+
+	glGenBuffers(BUFFER_MAX, &this->BufferName[0]);
+	for(std::size_t BufferIndex = 0; BufferIndex < BUFFER_MAX; ++BufferIndex)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->BufferName[BufferIndex]);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(Data.size() * sizeof(glm::uint)), &Data[0], GL_STATIC_DRAW);
+	}
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	return true;
+}
+
+bool testCompute::render()
+{
+	this->beginTimer();
+	for(std::size_t DispatchIndex = 0; DispatchIndex < this->DispatchCount; ++DispatchIndex)
+	{
+		if(DispatchIndex > 0 && this->Barrier == BARRIER_STORAGE)
+			glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, semantics::INPUT, this->BufferName[DispatchIndex % 2 ? BUFFER_PONG : BUFFER_PING]);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, semantics::OUTPUT, this->BufferName[DispatchIndex % 2 ? BUFFER_PING : BUFFER_PONG]);
+		glDispatchCompute(this->GroupCount.x, this->GroupCount.y, 1);
+	}
+	this->endTimer();
+
+	this->addDispatchCount(this->DispatchCount);
+
+	return true;
+}
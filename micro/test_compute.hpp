@@ -0,0 +1,67 @@
+#ifndef TEST_COMPUTE_INCLUDED
+#define TEST_COMPUTE_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Each frame submits DispatchCount dispatches of InvocationCount invocations, grouped by LocalSize.
+// Successive dispatches swap the input and output buffers so that each one reads the result of the previous one.
+class testCompute : public test
+{
+public:
+	enum pattern
+	{
+		// Invocation i reads and writes element i
+		COALESCED,
+		// Invocation i reads and writes element i * STRIDE modulo InvocationCount
+		STRIDED,
+		// All invocations accumulate on ATOMIC_COUNTER_COUNT elements with atomicAdd
+		ATOMIC,
+		// Each work group sums its inputs in shared memory and writes a single element
+		SHARED_REDUCTION,
+		PATTERN_MAX
+	};
+
+	enum barrier
+	{
+		// Back to back dispatches, the GL doesn't have to order their storage accesses
+		BARRIER_NONE,
+		// glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT) between dispatches
+		BARRIER_STORAGE,
+		BARRIER_MAX
+	};
+
+public:
+	testCompute(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		pattern Pattern, barrier Barrier, glm::uvec3 const & LocalSize, std::size_t InvocationCount, std::size_t DispatchCount);
+	virtual ~testCompute();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	enum buffer
+	{
+		BUFFER_PING,
+		BUFFER_PONG,
+		BUFFER_MAX
+	};
+
+	bool checkLimits() const;
+	bool initProgram();
+	bool initBuffer();
+
+	pattern const Pattern;
+	barrier const Barrier;
+	glm::uvec3 const LocalSize;
+	std::size_t const InvocationCount;
+	std::size_t const DispatchCount;
+	// Work groups are spread on x then y to stay within GL_MAX_COMPUTE_WORK_GROUP_COUNT
+	glm::uvec2 GroupCount;
+	std::array<GLuint, BUFFER_MAX> BufferName;
+	GLuint ProgramName;
+};
+
+#endif//TEST_COMPUTE_INCLUDED
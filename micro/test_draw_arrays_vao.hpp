@@ -2,6 +2,7 @@
 #define TEST_DRAW_ARRAYS_VAO_INCLUDED
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 
 class testDrawArraysVAO : public test
 {
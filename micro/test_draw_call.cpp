@@ -22,6 +22,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 #include "test_draw_call.hpp"
 
 namespace
@@ -250,6 +251,7 @@ private:
 			case DRAW_SINGLE:
 			{
 				glDrawArraysInstanced(GL_TRIANGLES, 0, VertexCount, 1);
+				this->addDrawCount(1);
 			}
 			break;
 			case DRAW_PER_TILE:
@@ -261,6 +263,7 @@ private:
 						static_cast<GLsizei>(6 * this->TrianglePairPerTile / this->DrawPerTile),
 						1);
 				}
+				this->addDrawCount(VertexCount / (6 * this->TrianglePairPerTile / this->DrawPerTile));
 			}
 			break;
 			default:
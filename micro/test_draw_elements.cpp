@@ -29,8 +29,8 @@ namespace
 		GLuint baseInstance;
 	};
 
-	char const * VERT_SHADER_SOURCE("hz-430/vertex-array-object.vert");
-	char const * FRAG_SHADER_SOURCE("hz-430/vertex-array-object.frag");
+	char const * VERT_SHADER_SOURCE("micro/vertex-array-object.vert");
+	char const * FRAG_SHADER_SOURCE("micro/vertex-array-object.frag");
 }//namespace
 
 testDrawElements::testDrawElements(
@@ -244,6 +244,7 @@ bool testDrawElements::render()
 		break;
 	}
 	this->endTimer();
+	this->addDrawCount(this->DrawCount);
 
 	return true;
 }
@@ -2,6 +2,7 @@
 #define TEST_DRAW_ELEMENTS_INCLUDED
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 
 class testDrawElements : public test
 {
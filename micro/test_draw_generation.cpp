@@ -0,0 +1,198 @@
+#include "test_draw_generation.hpp"
+
+namespace
+{
+	char const * VERT_SHADER_SOURCE("micro/test_draw_generation.vert");
+	char const * FRAG_SHADER_SOURCE("micro/test_draw_generation.frag");
+
+	GLsizei const ElementCount(6);
+}//namespace
+
+testDrawGeneration::testDrawGeneration(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	std::size_t DrawCount, std::size_t ThreadCount
+) :
+	test(argc, argv, "testDrawGeneration", Profile, 4, 3, FrameCount),
+	DrawCount(DrawCount),
+	ThreadCount(ThreadCount),
+	ProgramName(0),
+	VertexArrayName(0),
+	FrameIndex(0)
+{
+	assert(DrawCount > 0 && ThreadCount > 0);
+
+	this->BufferName.fill(0);
+}
+
+testDrawGeneration::~testDrawGeneration()
+{}
+
+bool testDrawGeneration::begin()
+{
+	bool Validated = this->checkExtension("GL_ARB_buffer_storage");
+
+	if(Validated)
+		Validated = this->initProgram();
+	if(Validated)
+		Validated = this->initBuffer();
+	if(Validated)
+		Validated = this->initVertexArray();
+
+	if(Validated)
+	{
+		this->Jobs.reset(new jobs(this->ThreadCount));
+
+		glUseProgram(this->ProgramName);
+		glBindVertexArray(this->VertexArrayName);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->Ring->name());
+	}
+
+	return Validated && this->checkError("begin");
+}
+
+bool testDrawGeneration::end()
+{
+	this->Jobs.reset();
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	this->Ring.reset();
+	glDeleteVertexArrays(1, &this->VertexArrayName);
+	glDeleteBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glDeleteProgram(this->ProgramName);
+
+	return true;
+}
+
+bool testDrawGeneration::initProgram()
+{
+	compiler Compiler;
+	GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE);
+	GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+
+	this->ProgramName = glCreateProgram();
+	glAttachShader(this->ProgramName, VertShaderName);
+	glAttachShader(this->ProgramName, FragShaderName);
+	glLinkProgram(this->ProgramName);
+
+	bool Validated = Compiler.check();
+	Validated = Validated && Compiler.checkProgram(this->ProgramName);
+
+	return Validated;
+}
+
+// A single quad shared by all the draws, the per draw data is generated each frame in the ring
+bool testDrawGeneration::initBuffer()
+{
+	glm::vec2 const Positions[] =
+	{
+		glm::vec2(-1.0f,-1.0f),
+		glm::vec2( 1.0f,-1.0f),
+		glm::vec2( 1.0f, 1.0f),
+		glm::vec2(-1.0f, 1.0f)
+	};
+
+	glm::uint const Elements[ElementCount] =
+	{
+		0, 1, 2,
+		2, 3, 0
+	};
+
+	std::vector<glm::uint> DrawIDs(this->DrawCount);
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+		DrawIDs[DrawIndex] = static_cast<glm::uint>(DrawIndex);
+
+	glGenBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Positions), Positions, GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_DRAW_ID]);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(DrawIDs.size() * sizeof(glm::uint)), &DrawIDs[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->BufferName[BUFFER_ELEMENT]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(Elements), Elements, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	// The transforms are bound with glBindBufferRange, the commands only need a 4 bytes alignment
+	GLint Alignment = 0;
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &Alignment);
+	std::size_t const FrameSize = this->DrawCount * (sizeof(DrawElementsIndirectCommand) + sizeof(glm::mat4)) + Alignment * 2;
+
+	this->Ring.reset(new gl::ring(FrameSize * FRAME_COUNT, static_cast<std::size_t>(glm::max(Alignment, 16))));
+
+	return this->Ring->isValid();
+}
+
+bool testDrawGeneration::initVertexArray()
+{
+	glGenVertexArrays(1, &this->VertexArrayName);
+	glBindVertexArray(this->VertexArrayName);
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+		glVertexAttribPointer(semantic::attr::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), BUFFER_OFFSET(0));
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_DRAW_ID]);
+		glVertexAttribIPointer(semantic::attr::DRAW_ID, 1, GL_UNSIGNED_INT, sizeof(glm::uint), BUFFER_OFFSET(0));
+		glVertexAttribDivisor(semantic::attr::DRAW_ID, 1);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glEnableVertexAttribArray(semantic::attr::POSITION);
+		glEnableVertexAttribArray(semantic::attr::DRAW_ID);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->BufferName[BUFFER_ELEMENT]);
+	glBindVertexArray(0);
+
+	return true;
+}
+
+// Quads on a grid covering the viewport, each spinning at its own phase
+void testDrawGeneration::generate(std::size_t Begin, std::size_t End, DrawElementsIndirectCommand* Commands, glm::mat4* Transforms, float Time) const
+{
+	glm::uint const Columns = static_cast<glm::uint>(glm::ceil(glm::sqrt(static_cast<float>(this->DrawCount))));
+	float const QuadSize(2.0f / static_cast<float>(Columns));
+
+	for(std::size_t DrawIndex = Begin; DrawIndex < End; ++DrawIndex)
+	{
+		glm::vec2 const Center = (glm::vec2(DrawIndex % Columns, DrawIndex / Columns) + 0.5f) * QuadSize - 1.0f;
+
+		glm::mat4 Model = glm::translate(glm::mat4(1.0f), glm::vec3(Center, 0.0f));
+		Model = glm::rotate(Model, Time + static_cast<float>(DrawIndex) * 0.1f, glm::vec3(0.0f, 0.0f, 1.0f));
+		Model = glm::scale(Model, glm::vec3(QuadSize * 0.35f));
+
+		Transforms[DrawIndex] = Model;
+		Commands[DrawIndex] = DrawElementsIndirectCommand(ElementCount, 1, 0, 0, static_cast<GLuint>(DrawIndex));
+	}
+}
+
+bool testDrawGeneration::render()
+{
+	glm::uvec2 const WindowSize = this->getWindowSize();
+	glViewport(0, 0, static_cast<GLsizei>(WindowSize.x), static_cast<GLsizei>(WindowSize.y));
+	glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)[0]);
+
+	// May wait for the GPU to release the frame FRAME_COUNT frames ago, the cpu render row includes this wait
+	gl::ring::allocation const CommandAllocation = this->Ring->allocate(this->DrawCount * sizeof(DrawElementsIndirectCommand));
+	gl::ring::allocation const TransformAllocation = this->Ring->allocate(this->DrawCount * sizeof(glm::mat4));
+	if(!CommandAllocation.Pointer || !TransformAllocation.Pointer)
+		return false;
+
+	this->beginTimer();
+
+	DrawElementsIndirectCommand* Commands = static_cast<DrawElementsIndirectCommand*>(CommandAllocation.Pointer);
+	glm::mat4* Transforms = static_cast<glm::mat4*>(TransformAllocation.Pointer);
+	float const Time = static_cast<float>(this->FrameIndex) * 0.01f;
+
+	this->Jobs->run(this->DrawCount, [this, Commands, Transforms, Time](std::size_t Begin, std::size_t End)
+	{
+		this->generate(Begin, End, Commands, Transforms, Time);
+	});
+
+	glBindBufferRange(GL_SHADER_STORAGE_BUFFER, semantic::storage::TRANSFORM, this->Ring->name(),
+		static_cast<GLintptr>(TransformAllocation.Offset), static_cast<GLsizeiptr>(TransformAllocation.Size));
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, BUFFER_OFFSET(CommandAllocation.Offset), static_cast<GLsizei>(this->DrawCount), 0);
+	this->Ring->fence();
+
+	this->endTimer();
+	this->addDrawCount(this->DrawCount);
+
+	++this->FrameIndex;
+
+	return true;
+}
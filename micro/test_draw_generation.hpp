@@ -0,0 +1,56 @@
+#ifndef TEST_DRAW_GENERATION_INCLUDED
+#define TEST_DRAW_GENERATION_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+#include "buffer.hpp"
+#include "jobs.hpp"
+
+// Each frame, ThreadCount threads compute the transform and the indirect command of DrawCount animated quads
+// straight into a persistently mapped gl::ring, then the render thread submits them with a single glMultiDrawElementsIndirect.
+// The time sample is the generation and submission time, without the wait for a free region of the ring.
+class testDrawGeneration : public test
+{
+public:
+	testDrawGeneration(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		std::size_t DrawCount, std::size_t ThreadCount);
+	virtual ~testDrawGeneration();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	enum buffer
+	{
+		BUFFER_VERTEX,
+		BUFFER_ELEMENT,
+		BUFFER_DRAW_ID,
+		BUFFER_MAX
+	};
+
+	enum
+	{
+		// Frames in flight in the ring
+		FRAME_COUNT = 3
+	};
+
+	bool initProgram();
+	bool initBuffer();
+	bool initVertexArray();
+
+	// Runs on the job threads, writes the draws [Begin, End) of the frame
+	void generate(std::size_t Begin, std::size_t End, DrawElementsIndirectCommand* Commands, glm::mat4* Transforms, float Time) const;
+
+	std::size_t const DrawCount;
+	std::size_t const ThreadCount;
+	std::unique_ptr<jobs> Jobs;
+	std::unique_ptr<gl::ring> Ring;
+	std::array<GLuint, BUFFER_MAX> BufferName;
+	GLuint ProgramName;
+	GLuint VertexArrayName;
+	std::size_t FrameIndex;
+};
+
+#endif//TEST_DRAW_GENERATION_INCLUDED
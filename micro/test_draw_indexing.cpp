@@ -22,8 +22,8 @@ namespace
 		GLuint baseInstance;
 	};
 
-	char const * VERT_SHADER_SOURCE[testDrawIndexing::INDEXING_MAX] = {"hz-430/draw.vert", "hz-430/draw-indexing-uniform.vert", "hz-430/draw-indexing-attrib.vert", "hz-430/draw-indexing-attrib.vert", "hz-430/draw-indexing-attrib.vert", "hz-430/draw-indexing-id.vert"};
-	char const * FRAG_SHADER_SOURCE[testDrawIndexing::INDEXING_MAX] = {"hz-430/draw.frag", "hz-430/draw-indexing-uniform.frag", "hz-430/draw-indexing-attrib.frag", "hz-430/draw-indexing-attrib.frag", "hz-430/draw-indexing-attrib.frag", "hz-430/draw-indexing-id.frag"};
+	char const * VERT_SHADER_SOURCE[testDrawIndexing::INDEXING_MAX] = {"micro/draw.vert", "micro/draw-indexing-uniform.vert", "micro/draw-indexing-attrib.vert", "micro/draw-indexing-attrib.vert", "micro/draw-indexing-attrib.vert", "micro/draw-indexing-id.vert"};
+	char const * FRAG_SHADER_SOURCE[testDrawIndexing::INDEXING_MAX] = {"micro/draw.frag", "micro/draw-indexing-uniform.frag", "micro/draw-indexing-attrib.frag", "micro/draw-indexing-attrib.frag", "micro/draw-indexing-attrib.frag", "micro/draw-indexing-id.frag"};
 
 	GLint UniformDrawIndex(-1);
 }//namespace
@@ -235,6 +235,7 @@ bool testDrawIndexing::render()
 		break;
 	}
 	this->endTimer();
+	this->addDrawCount(this->DrawCount);
 
 	return true;
 }
@@ -2,6 +2,7 @@
 #define TEST_DRAW_INDEXING_INCLUDED
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 
 class testDrawIndexing : public test
 {
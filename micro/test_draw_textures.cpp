@@ -0,0 +1,330 @@
+#include "test_draw_textures.hpp"
+#include <cstring>
+
+namespace
+{
+	char const * VERT_SHADER_SOURCE("micro/test_draw_textures.vert");
+	char const * FRAG_SHADER_SOURCE("micro/test_draw_textures.frag");
+
+	GLsizei const VertexCount(6);
+
+	// Location of the TextureCount uniform
+	GLint const TEXTURE_COUNT_LOCATION(0);
+
+	char const * modeDefine(testDrawTextures::mode Mode)
+	{
+		switch(Mode)
+		{
+			case testDrawTextures::BIND_PER_DRAW:
+				return "--define BIND_PER_DRAW";
+			case testDrawTextures::MULTI_BIND:
+				return "--define MULTI_BIND";
+			case testDrawTextures::TEXTURE_ARRAY:
+				return "--define TEXTURE_ARRAY";
+			case testDrawTextures::BINDLESS_UBO:
+				return "--define BINDLESS_UBO";
+			case testDrawTextures::BINDLESS_SSBO:
+				return "--define BINDLESS_SSBO";
+			case testDrawTextures::BINDLESS_MULTI_DRAW:
+				return "--define BINDLESS_MULTI_DRAW";
+			default:
+				assert(0);
+				return "";
+		}
+	}
+}//namespace
+
+testDrawTextures::testDrawTextures(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	mode Mode, std::size_t DrawCount, std::size_t TextureCount
+) :
+	test(argc, argv, "testDrawTextures", Profile, 4, 3, FrameCount),
+	Mode(Mode),
+	DrawCount(DrawCount),
+	TextureCount(TextureCount),
+	ProgramName(0),
+	VertexArrayName(0)
+{
+	assert(DrawCount > 0 && TextureCount > 0);
+
+	this->BufferName.fill(0);
+
+	// The binding cost is on the CPU, the GPU timer can't see it
+	this->setCPUTimeSamples(true);
+}
+
+testDrawTextures::~testDrawTextures()
+{}
+
+bool testDrawTextures::begin()
+{
+	if(this->isBindless() && !this->isExtensionSupported("GL_ARB_bindless_texture"))
+	{
+		this->skip("GL_ARB_bindless_texture is not supported");
+		return true;
+	}
+
+	if(this->Mode == BINDLESS_MULTI_DRAW && !this->isExtensionSupported("GL_ARB_shader_draw_parameters"))
+	{
+		this->skip("GL_ARB_shader_draw_parameters is not supported");
+		return true;
+	}
+
+	bool Validated = true;
+
+	if(this->Mode == TEXTURE_ARRAY)
+	{
+		GLint MaxLayers = 0;
+		glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &MaxLayers);
+		if(this->TextureCount > static_cast<std::size_t>(MaxLayers))
+		{
+			fprintf(stderr, "TextureCount %d exceeds GL_MAX_ARRAY_TEXTURE_LAYERS %d\n", static_cast<int>(this->TextureCount), MaxLayers);
+			Validated = false;
+		}
+	}
+
+	if(Validated && this->Mode == BINDLESS_UBO && this->TextureCount > BINDLESS_UBO_MAX)
+	{
+		fprintf(stderr, "TextureCount %d exceeds the %d handles of the uniform block\n", static_cast<int>(this->TextureCount), BINDLESS_UBO_MAX);
+		Validated = false;
+	}
+
+	if(Validated)
+		Validated = this->initProgram();
+	if(Validated)
+		Validated = this->initTexture();
+	if(Validated)
+		Validated = this->initBuffer();
+	if(Validated)
+		Validated = this->initVertexArray();
+
+	if(Validated)
+	{
+		glUseProgram(this->ProgramName);
+		glBindVertexArray(this->VertexArrayName);
+		glActiveTexture(GL_TEXTURE0 + semantic::sampler::DIFFUSE);
+
+		switch(this->Mode)
+		{
+			case TEXTURE_ARRAY:
+				glBindTexture(GL_TEXTURE_2D_ARRAY, this->TextureName[0]);
+				break;
+			case BINDLESS_UBO:
+				glBindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::MATERIAL, this->BufferName[BUFFER_HANDLE]);
+				break;
+			case BINDLESS_SSBO:
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, semantic::storage::MATERIAL, this->BufferName[BUFFER_HANDLE]);
+				break;
+			case BINDLESS_MULTI_DRAW:
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, semantic::storage::MATERIAL, this->BufferName[BUFFER_HANDLE]);
+				glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->BufferName[BUFFER_INDIRECT]);
+				break;
+			default:
+				break;
+		}
+	}
+
+	return Validated && this->checkError("begin");
+}
+
+bool testDrawTextures::end()
+{
+	for(std::size_t TextureIndex = 0; TextureIndex < this->TextureHandle.size(); ++TextureIndex)
+		glMakeTextureHandleNonResidentARB(this->TextureHandle[TextureIndex]);
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glDeleteVertexArrays(1, &this->VertexArrayName);
+	glDeleteBuffers(BUFFER_MAX, &this->BufferName[0]);
+	if(!this->TextureName.empty())
+		glDeleteTextures(static_cast<GLsizei>(this->TextureName.size()), &this->TextureName[0]);
+	glDeleteProgram(this->ProgramName);
+
+	return true;
+}
+
+bool testDrawTextures::initProgram()
+{
+	compiler Compiler;
+	GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE, modeDefine(this->Mode));
+	GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE, modeDefine(this->Mode));
+
+	this->ProgramName = glCreateProgram();
+	glAttachShader(this->ProgramName, VertShaderName);
+	glAttachShader(this->ProgramName, FragShaderName);
+	glLinkProgram(this->ProgramName);
+
+	bool Validated = Compiler.check();
+	Validated = Validated && Compiler.checkProgram(this->ProgramName);
+
+	if(Validated)
+		glProgramUniform1ui(this->ProgramName, TEXTURE_COUNT_LOCATION, static_cast<GLuint>(this->TextureCount));
+
+	return Validated;
+}
+
+// One quad per draw on a grid covering the viewport
+bool testDrawTextures::initBuffer()
+{
+	glm::uint const Columns = static_cast<glm::uint>(glm::ceil(glm::sqrt(static_cast<float>(this->DrawCount))));
+	glm::vec2 const QuadSize(2.0f / static_cast<float>(Columns));
+
+	std::vector<glf::vertex_v2fv2f> Vertices;
+	Vertices.reserve(this->DrawCount * VertexCount);
+	std::vector<glm::uint> DrawIDs(this->DrawCount);
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+	{
+		glm::vec2 const Min = glm::vec2(DrawIndex % Columns, DrawIndex / Columns) * QuadSize - 1.0f;
+		glm::vec2 const Max = Min + QuadSize;
+
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Min.y), glm::vec2(0.0f, 0.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Min.y), glm::vec2(1.0f, 0.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Max.y), glm::vec2(1.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Max.y), glm::vec2(1.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Max.y), glm::vec2(0.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Min.y), glm::vec2(0.0f, 0.0f)));
+
+		DrawIDs[DrawIndex] = static_cast<glm::uint>(DrawIndex);
+	}
+
+	glGenBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(Vertices.size() * sizeof(glf::vertex_v2fv2f)), &Vertices[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_DRAW_ID]);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(DrawIDs.size() * sizeof(glm::uint)), &DrawIDs[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if(this->Mode == BINDLESS_MULTI_DRAW)
+	{
+		std::vector<DrawArraysIndirectCommand> Commands(this->DrawCount);
+		for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+		{
+			Commands[DrawIndex].count = VertexCount;
+			Commands[DrawIndex].primCount = 1;
+			Commands[DrawIndex].first = static_cast<GLuint>(DrawIndex * VertexCount);
+			Commands[DrawIndex].baseInstance = 0;
+		}
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->BufferName[BUFFER_INDIRECT]);
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(Commands.size() * sizeof(DrawArraysIndirectCommand)), &Commands[0], GL_STATIC_DRAW);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+
+	if(!this->isBindless())
+		return true;
+
+	// std140 rounds the stride of the uvec2 handle array up to 16 bytes, std430 keeps it tight
+	std::size_t const Stride = this->Mode == BINDLESS_UBO ? sizeof(GLuint64) * 2 : sizeof(GLuint64);
+	std::vector<glm::byte> Handles(this->Mode == BINDLESS_UBO ? BINDLESS_UBO_MAX * Stride : this->TextureCount * Stride, 0);
+	for(std::size_t TextureIndex = 0; TextureIndex < this->TextureCount; ++TextureIndex)
+		memcpy(&Handles[TextureIndex * Stride], &this->TextureHandle[TextureIndex], sizeof(GLuint64));
+
+	GLenum const Target = this->Mode == BINDLESS_UBO ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+	glBindBuffer(Target, this->BufferName[BUFFER_HANDLE]);
+	glBufferData(Target, static_cast<GLsizeiptr>(Handles.size()), &Handles[0], GL_STATIC_DRAW);
+	glBindBuffer(Target, 0);
+
+	return true;
+}
+
+// 4x4 textures of a random color each, sampled without filtering so that bindless handles can use the texture parameters
+bool testDrawTextures::initTexture()
+{
+	if(this->Mode == TEXTURE_ARRAY)
+	{
+		GLsizei const Layers = static_cast<GLsizei>(this->TextureCount);
+
+		this->TextureName.resize(1);
+		glGenTextures(1, &this->TextureName[0]);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, this->TextureName[0]);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, 4, 4, Layers);
+		for(GLsizei Layer = 0; Layer < Layers; ++Layer)
+		{
+			std::vector<glm::u8vec4> Texels(4 * 4, glm::u8vec4(glm::linearRand(glm::vec4(0), glm::vec4(255))));
+			glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, Layer, 4, 4, 1, GL_RGBA, GL_UNSIGNED_BYTE, &Texels[0]);
+		}
+		glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+		return true;
+	}
+
+	this->TextureName.resize(this->TextureCount);
+	glGenTextures(static_cast<GLsizei>(this->TextureCount), &this->TextureName[0]);
+
+	for(std::size_t TextureIndex = 0; TextureIndex < this->TextureCount; ++TextureIndex)
+	{
+		std::vector<glm::u8vec4> Texels(4 * 4, glm::u8vec4(glm::linearRand(glm::vec4(0), glm::vec4(255))));
+
+		glBindTexture(GL_TEXTURE_2D, this->TextureName[TextureIndex]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 4, 4);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, &Texels[0]);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	this->DrawTextureName.resize(this->DrawCount);
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+		this->DrawTextureName[DrawIndex] = this->TextureName[DrawIndex % this->TextureCount];
+
+	if(this->isBindless())
+	{
+		this->TextureHandle.resize(this->TextureCount);
+		for(std::size_t TextureIndex = 0; TextureIndex < this->TextureCount; ++TextureIndex)
+		{
+			this->TextureHandle[TextureIndex] = glGetTextureHandleARB(this->TextureName[TextureIndex]);
+			glMakeTextureHandleResidentARB(this->TextureHandle[TextureIndex]);
+		}
+	}
+
+	return true;
+}
+
+bool testDrawTextures::initVertexArray()
+{
+	glGenVertexArrays(1, &this->VertexArrayName);
+	glBindVertexArray(this->VertexArrayName);
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+		glVertexAttribPointer(semantic::attr::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(glf::vertex_v2fv2f), BUFFER_OFFSET(0));
+		glVertexAttribPointer(semantic::attr::TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof(glf::vertex_v2fv2f), BUFFER_OFFSET(sizeof(glm::vec2)));
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_DRAW_ID]);
+		glVertexAttribIPointer(semantic::attr::DRAW_ID, 1, GL_UNSIGNED_INT, sizeof(glm::uint), BUFFER_OFFSET(0));
+		glVertexAttribDivisor(semantic::attr::DRAW_ID, 1);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glEnableVertexAttribArray(semantic::attr::POSITION);
+		glEnableVertexAttribArray(semantic::attr::TEXCOORD);
+		glEnableVertexAttribArray(semantic::attr::DRAW_ID);
+	glBindVertexArray(0);
+
+	return true;
+}
+
+bool testDrawTextures::render()
+{
+	glm::uvec2 const WindowSize = this->getWindowSize();
+	glViewport(0, 0, static_cast<GLsizei>(WindowSize.x), static_cast<GLsizei>(WindowSize.y));
+	glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)[0]);
+
+	if(this->Mode == BINDLESS_MULTI_DRAW)
+	{
+		glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(this->DrawCount), 0);
+		this->addDrawCount(this->DrawCount);
+		return true;
+	}
+
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+	{
+		if(this->Mode == BIND_PER_DRAW)
+			glBindTexture(GL_TEXTURE_2D, this->DrawTextureName[DrawIndex]);
+		else if(this->Mode == MULTI_BIND && DrawIndex % UNIT_COUNT == 0)
+			glBindTextures(semantic::sampler::DIFFUSE, static_cast<GLsizei>(glm::min<std::size_t>(UNIT_COUNT, this->DrawCount - DrawIndex)), &this->DrawTextureName[DrawIndex]);
+
+		glDrawArraysInstancedBaseInstance(GL_TRIANGLES, static_cast<GLint>(DrawIndex * VertexCount), VertexCount, 1, static_cast<GLuint>(DrawIndex));
+	}
+
+	this->addDrawCount(this->DrawCount);
+
+	return true;
+}
@@ -0,0 +1,80 @@
+#ifndef TEST_DRAW_TEXTURES_INCLUDED
+#define TEST_DRAW_TEXTURES_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Each draw samples the texture of its material, draw i uses the texture i modulo TextureCount.
+// The per draw modes issue one call per draw and pass the draw index through an instanced attribute and the base instance,
+// so that they only differ by how the texture is selected. BINDLESS_MULTI_DRAW submits all the draws with a single
+// glMultiDrawArraysIndirect. The bindless modes are skipped without GL_ARB_bindless_texture.
+class testDrawTextures : public test
+{
+public:
+	enum mode
+	{
+		// glBindTexture before each draw
+		BIND_PER_DRAW,
+		// glBindTextures on UNIT_COUNT units every UNIT_COUNT draws
+		MULTI_BIND,
+		// A single texture array, draws index its layers
+		TEXTURE_ARRAY,
+		// Resident texture handles in a uniform buffer, at most BINDLESS_UBO_MAX textures
+		BINDLESS_UBO,
+		// Resident texture handles in a shader storage buffer
+		BINDLESS_SSBO,
+		// Resident texture handles in a shader storage buffer indexed by gl_DrawIDARB of a single multi draw,
+		// skipped without GL_ARB_shader_draw_parameters
+		BINDLESS_MULTI_DRAW,
+		MODE_MAX
+	};
+
+public:
+	testDrawTextures(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		mode Mode, std::size_t DrawCount, std::size_t TextureCount);
+	virtual ~testDrawTextures();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	enum buffer
+	{
+		BUFFER_VERTEX,
+		BUFFER_DRAW_ID,
+		BUFFER_HANDLE,
+		BUFFER_INDIRECT,
+		BUFFER_MAX
+	};
+
+	enum
+	{
+		// The minimum GL_MAX_TEXTURE_IMAGE_UNITS
+		UNIT_COUNT = 16,
+		// The minimum GL_MAX_UNIFORM_BLOCK_SIZE divided by the std140 array stride
+		BINDLESS_UBO_MAX = 1024
+	};
+
+	bool initProgram();
+	bool initBuffer();
+	bool initTexture();
+	bool initVertexArray();
+
+	bool isBindless() const{return this->Mode == BINDLESS_UBO || this->Mode == BINDLESS_SSBO || this->Mode == BINDLESS_MULTI_DRAW;}
+
+	mode const Mode;
+	std::size_t const DrawCount;
+	std::size_t const TextureCount;
+	// One texture per material, or one texture array with a layer per material
+	std::vector<GLuint> TextureName;
+	// Texture sampled by each draw
+	std::vector<GLuint> DrawTextureName;
+	std::vector<GLuint64> TextureHandle;
+	std::array<GLuint, BUFFER_MAX> BufferName;
+	GLuint ProgramName;
+	GLuint VertexArrayName;
+};
+
+#endif//TEST_DRAW_TEXTURES_INCLUDED
@@ -0,0 +1,96 @@
+#include "test_generate_mipmaps.hpp"
+#include <gli/core/generate_mipmaps.hpp>
+
+namespace
+{
+	// Scalar 8 bits box filter gli used before gli::generate_mipmaps, with its destination pitch fixed
+	void generateMipmapsReference(gli::texture2D & Texture)
+	{
+		gli::texture2D::size_type const Components(gli::component_count(Texture.format()));
+
+		for(gli::texture2D::size_type Level = Texture.baseLevel(); Level < Texture.maxLevel(); ++Level)
+		{
+			std::size_t BaseWidth = Texture[Level].dimensions().x;
+			void * DataSrc = Texture[Level + 0].data();
+
+			gli::texture2D::dim_type LevelDimensions = gli::texture2D::dim_type(Texture[Level].dimensions()) >> gli::texture2D::dim_type(1);
+			LevelDimensions = glm::max(LevelDimensions, gli::texture2D::dim_type(1));
+			void * DataDst = Texture[Level + 1].data();
+
+			for(std::size_t j = 0; j < LevelDimensions.y; ++j)
+			for(std::size_t i = 0; i < LevelDimensions.x;  ++i)
+			for(std::size_t c = 0; c < Components; ++c)
+			{
+				std::size_t x = (i << 1);
+				std::size_t y = (j << 1);
+
+				std::size_t Index00 = ((x + 0) + (y + 0) * BaseWidth) * Components + c;
+				std::size_t Index01 = ((x + 0) + (y + 1) * BaseWidth) * Components + c;
+				std::size_t Index11 = ((x + 1) + (y + 1) * BaseWidth) * Components + c;
+				std::size_t Index10 = ((x + 1) + (y + 0) * BaseWidth) * Components + c;
+
+				glm::u32 Data00 = reinterpret_cast<glm::byte *>(DataSrc)[Index00];
+				glm::u32 Data01 = reinterpret_cast<glm::byte *>(DataSrc)[Index01];
+				glm::u32 Data11 = reinterpret_cast<glm::byte *>(DataSrc)[Index11];
+				glm::u32 Data10 = reinterpret_cast<glm::byte *>(DataSrc)[Index10];
+
+				std::size_t IndexDst = (i + j * LevelDimensions.x) * Components + c;
+
+				*(reinterpret_cast<glm::byte *>(DataDst) + IndexDst) = (Data00 + Data01 + Data11 + Data10) >> 2;
+			}
+		}
+	}
+}//namespace
+
+testGenerateMipmaps::testGenerateMipmaps(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	mode Mode, std::string const & Filename
+) :
+	test(argc, argv, "testGenerateMipmaps", Profile, 4, 2, FrameCount),
+	Texture(gli::load_dds((getDataDirectory() + Filename).c_str())),
+	Mode(Mode)
+{
+	this->setCPUTimeSamples(true);
+}
+
+testGenerateMipmaps::~testGenerateMipmaps()
+{}
+
+bool testGenerateMipmaps::begin()
+{
+	if(this->Texture.empty() || this->Texture.levels() < 2)
+		return false;
+
+	// The reference path only averages bytes
+	if(this->Mode == REFERENCE && gli::block_size(this->Texture.format()) != gli::component_count(this->Texture.format()))
+		return false;
+
+	return true;
+}
+
+bool testGenerateMipmaps::end()
+{
+	return true;
+}
+
+bool testGenerateMipmaps::render()
+{
+	bool Success = true;
+	switch(this->Mode)
+	{
+		case REFERENCE:
+			generateMipmapsReference(this->Texture);
+			break;
+		case BOX:
+			Success = gli::generate_mipmaps(this->Texture, gli::FILTER_BOX);
+			break;
+		case KAISER:
+			Success = gli::generate_mipmaps(this->Texture, gli::FILTER_KAISER);
+			break;
+		default:
+			assert(0);
+			break;
+	}
+
+	return Success;
+}
@@ -0,0 +1,33 @@
+#ifndef TEST_GENERATE_MIPMAPS_INCLUDED
+#define TEST_GENERATE_MIPMAPS_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+class testGenerateMipmaps : public test
+{
+public:
+	enum mode
+	{
+		REFERENCE,
+		BOX,
+		KAISER,
+		MODE_MAX
+	};
+
+public:
+	testGenerateMipmaps(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		mode Mode, std::string const & Filename);
+	virtual ~testGenerateMipmaps();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	gli::texture2D Texture;
+	mode const Mode;
+};
+
+#endif//TEST_GENERATE_MIPMAPS_INCLUDED
@@ -0,0 +1,94 @@
+#include "test_preprocess.hpp"
+
+testPreprocess::testPreprocess(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	std::size_t IncludeCount, std::size_t LineCount
+) :
+	test(argc, argv, "testPreprocess", Profile, 3, 3, FrameCount),
+	IncludeCount(IncludeCount),
+	LineCount(LineCount)
+{
+	assert(IncludeCount > 0 && LineCount > 0);
+
+	// Preprocessing is CPU side, there is no GPU work to time
+	this->setCPUTimeSamples(true);
+}
+
+testPreprocess::~testPreprocess()
+{}
+
+bool testPreprocess::writeFile(std::string const & Filename, std::string const & Source) const
+{
+	FILE* File = fopen(Filename.c_str(), "wb");
+	if(!File)
+	{
+		fprintf(stderr, "Failed to write %s\n", Filename.c_str());
+		return false;
+	}
+
+	bool const Success = fwrite(Source.data(), Source.size(), 1, File) == 1;
+	return fclose(File) == 0 && Success;
+}
+
+// Includes mix code, comments and commented out directives so that every branch of the parser runs on each line
+bool testPreprocess::begin()
+{
+	std::string const Directory = getBinaryDirectory();
+
+	std::string Main("#version 330 core\n\n");
+	for(std::size_t IncludeIndex = 0; IncludeIndex < this->IncludeCount; ++IncludeIndex)
+	{
+		std::string Include;
+		for(std::size_t LineIndex = 0; LineIndex < this->LineCount; ++LineIndex)
+		{
+			switch(LineIndex % 4)
+			{
+				case 0:
+					Include += format("// Block %d of include %d\n", static_cast<int>(LineIndex), static_cast<int>(IncludeIndex));
+					break;
+				case 1:
+					Include += format("#define VALUE_%d_%d %d.0\n", static_cast<int>(IncludeIndex), static_cast<int>(LineIndex), static_cast<int>(LineIndex));
+					break;
+				case 2:
+					Include += "//#include \"disabled.glsl\"\n";
+					break;
+				default:
+					Include += format("float value_%d_%d = 1.0; // Not a #version\n", static_cast<int>(IncludeIndex), static_cast<int>(LineIndex));
+					break;
+			}
+		}
+
+		this->IncludeFilename.push_back(format("test_preprocess-%d.glsl", static_cast<int>(IncludeIndex)));
+		if(!this->writeFile(Directory + this->IncludeFilename.back(), Include))
+			return false;
+
+		Main += format("#include \"%s\"\n", this->IncludeFilename.back().c_str());
+	}
+	Main += "\nout vec4 Color;\n\nvoid main()\n{\n\tColor = vec4(1.0);\n}\n";
+
+	this->Filename = Directory + "test_preprocess.frag";
+	return this->writeFile(this->Filename, Main);
+}
+
+bool testPreprocess::end()
+{
+	std::string const Directory = getBinaryDirectory();
+
+	for(std::size_t IncludeIndex = 0; IncludeIndex < this->IncludeFilename.size(); ++IncludeIndex)
+		std::remove((Directory + this->IncludeFilename[IncludeIndex]).c_str());
+	if(!this->Filename.empty())
+		std::remove(this->Filename.c_str());
+
+	return true;
+}
+
+bool testPreprocess::render()
+{
+	compiler Compiler;
+	std::string const Source = Compiler.preprocess(this->Filename);
+
+	this->addUploadSize(Source.size());
+
+	// Every include line is replaced by the content of the file
+	return Source.find("#include \"test_preprocess") == std::string::npos;
+}
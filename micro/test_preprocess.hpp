@@ -0,0 +1,30 @@
+#ifndef TEST_PREPROCESS_INCLUDED
+#define TEST_PREPROCESS_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Preprocess a generated shader including IncludeCount files of LineCount lines each, without the source cache.
+// The parser is linear in the source size when the MB per cpu second row doesn't depend on LineCount.
+class testPreprocess : public test
+{
+public:
+	testPreprocess(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		std::size_t IncludeCount, std::size_t LineCount);
+	virtual ~testPreprocess();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	bool writeFile(std::string const & Filename, std::string const & Source) const;
+
+	std::size_t const IncludeCount;
+	std::size_t const LineCount;
+	std::string Filename;
+	std::vector<std::string> IncludeFilename;
+};
+
+#endif//TEST_PREPROCESS_INCLUDED
@@ -2,6 +2,7 @@
 #define TEST_SCREENSPACE_COHERENCE_INCLUDED
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 
 class testScreenspaceCoherence : public test
 {
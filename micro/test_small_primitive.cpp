@@ -22,6 +22,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 #include "test_small_primitive.hpp"
 
 namespace
@@ -0,0 +1,221 @@
+#include "test_state_cache.hpp"
+
+namespace
+{
+	char const * VERT_SHADER_SOURCE("micro/test_state_cache.vert");
+	char const * FRAG_SHADER_SOURCE("micro/test_state_cache.frag");
+
+	GLsizei const VertexCount(6);
+}//namespace
+
+testStateCache::testStateCache(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	mode Mode, std::size_t DrawCount, std::size_t MaterialCount
+) :
+	test(argc, argv, "testStateCache", Profile, 4, 2, FrameCount),
+	Mode(Mode),
+	DrawCount(DrawCount),
+	MaterialCount(MaterialCount),
+	VertexArrayName(0),
+	SamplerName(0)
+{
+	assert(MaterialCount > 0 && MaterialCount <= DrawCount);
+
+	this->BufferName.fill(0);
+}
+
+testStateCache::~testStateCache()
+{}
+
+bool testStateCache::begin()
+{
+	bool Validated = true;
+
+	if(Validated)
+		Validated = this->initProgram();
+	if(Validated)
+		Validated = this->initBuffer();
+	if(Validated)
+		Validated = this->initTexture();
+	if(Validated)
+		Validated = this->initVertexArray();
+
+	return Validated && this->checkError("begin");
+}
+
+bool testStateCache::end()
+{
+	// Through the cache so that it forgets the bindings of the deleted objects
+	gl::state & State = this->getState();
+	State.deleteVertexArrays(1, &this->VertexArrayName);
+	State.deleteBuffers(BUFFER_MAX, &this->BufferName[0]);
+	State.deleteSamplers(1, &this->SamplerName);
+	State.deleteTextures(static_cast<GLsizei>(this->TextureName.size()), &this->TextureName[0]);
+	for(std::size_t MaterialIndex = 0; MaterialIndex < this->ProgramName.size(); ++MaterialIndex)
+		State.deleteProgram(this->ProgramName[MaterialIndex]);
+
+	return true;
+}
+
+// Materials have their own program object, all built from the same shaders
+bool testStateCache::initProgram()
+{
+	compiler Compiler;
+	GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE);
+	GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+
+	bool Validated = Compiler.check();
+
+	this->ProgramName.resize(this->MaterialCount);
+	for(std::size_t MaterialIndex = 0; Validated && MaterialIndex < this->MaterialCount; ++MaterialIndex)
+	{
+		this->ProgramName[MaterialIndex] = glCreateProgram();
+		glAttachShader(this->ProgramName[MaterialIndex], VertShaderName);
+		glAttachShader(this->ProgramName[MaterialIndex], FragShaderName);
+		glLinkProgram(this->ProgramName[MaterialIndex]);
+
+		Validated = Validated && Compiler.checkProgram(this->ProgramName[MaterialIndex]);
+	}
+
+	return Validated;
+}
+
+// One quad per draw on a grid covering the viewport
+bool testStateCache::initBuffer()
+{
+	glm::uint const Columns = static_cast<glm::uint>(glm::ceil(glm::sqrt(static_cast<float>(this->DrawCount))));
+	glm::vec2 const QuadSize(2.0f / static_cast<float>(Columns));
+
+	std::vector<glf::vertex_v2fv2f> Vertices;
+	Vertices.reserve(this->DrawCount * VertexCount);
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+	{
+		glm::vec2 const Min = glm::vec2(DrawIndex % Columns, DrawIndex / Columns) * QuadSize - 1.0f;
+		glm::vec2 const Max = Min + QuadSize;
+
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Min.y), glm::vec2(0.0f, 0.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Min.y), glm::vec2(1.0f, 0.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Max.y), glm::vec2(1.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Max.x, Max.y), glm::vec2(1.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Max.y), glm::vec2(0.0f, 1.0f)));
+		Vertices.push_back(glf::vertex_v2fv2f(glm::vec2(Min.x, Min.y), glm::vec2(0.0f, 0.0f)));
+	}
+
+	glm::mat4 const MVP(1.0f);
+
+	glGenBuffers(BUFFER_MAX, &this->BufferName[0]);
+	glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(Vertices.size() * sizeof(glf::vertex_v2fv2f)), &Vertices[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_UNIFORM_BUFFER, this->BufferName[BUFFER_TRANSFORM]);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(MVP), &MVP[0][0], GL_STATIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	return true;
+}
+
+bool testStateCache::initTexture()
+{
+	this->TextureName.resize(this->MaterialCount);
+	glGenTextures(static_cast<GLsizei>(this->MaterialCount), &this->TextureName[0]);
+
+	for(std::size_t MaterialIndex = 0; MaterialIndex < this->MaterialCount; ++MaterialIndex)
+	{
+		std::vector<glm::u8vec4> Texels(4 * 4, glm::u8vec4(glm::linearRand(glm::vec4(0), glm::vec4(255))));
+
+		glBindTexture(GL_TEXTURE_2D, this->TextureName[MaterialIndex]);
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 4, 4);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, &Texels[0]);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenSamplers(1, &this->SamplerName);
+	glSamplerParameteri(this->SamplerName, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glSamplerParameteri(this->SamplerName, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	return true;
+}
+
+bool testStateCache::initVertexArray()
+{
+	glGenVertexArrays(1, &this->VertexArrayName);
+	glBindVertexArray(this->VertexArrayName);
+		glBindBuffer(GL_ARRAY_BUFFER, this->BufferName[BUFFER_VERTEX]);
+		glVertexAttribPointer(semantic::attr::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(glf::vertex_v2fv2f), BUFFER_OFFSET(0));
+		glVertexAttribPointer(semantic::attr::TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof(glf::vertex_v2fv2f), BUFFER_OFFSET(sizeof(glm::vec2)));
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glEnableVertexAttribArray(semantic::attr::POSITION);
+		glEnableVertexAttribArray(semantic::attr::TEXCOORD);
+	glBindVertexArray(0);
+
+	return true;
+}
+
+void testStateCache::setMaterial(std::size_t MaterialIndex)
+{
+	glUseProgram(this->ProgramName[MaterialIndex]);
+	glBindVertexArray(this->VertexArrayName);
+	glBindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, this->BufferName[BUFFER_TRANSFORM]);
+	glActiveTexture(GL_TEXTURE0 + semantic::sampler::DIFFUSE);
+	glBindTexture(GL_TEXTURE_2D, this->TextureName[MaterialIndex]);
+	glBindSampler(semantic::sampler::DIFFUSE, this->SamplerName);
+	glEnable(GL_DEPTH_TEST);
+	glDisable(GL_BLEND);
+}
+
+void testStateCache::setMaterialCached(std::size_t MaterialIndex)
+{
+	gl::state & State = this->getState();
+
+	State.useProgram(this->ProgramName[MaterialIndex]);
+	State.bindVertexArray(this->VertexArrayName);
+	State.bindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, this->BufferName[BUFFER_TRANSFORM]);
+	State.bindTexture(semantic::sampler::DIFFUSE, GL_TEXTURE_2D, this->TextureName[MaterialIndex]);
+	State.bindSampler(semantic::sampler::DIFFUSE, this->SamplerName);
+	State.enable(GL_DEPTH_TEST);
+	State.disable(GL_BLEND);
+}
+
+bool testStateCache::render()
+{
+	glm::uvec2 const WindowSize = this->getWindowSize();
+	glViewport(0, 0, static_cast<GLsizei>(WindowSize.x), static_cast<GLsizei>(WindowSize.y));
+	float const Depth(1.0f);
+	glClearBufferfv(GL_DEPTH, 0, &Depth);
+	glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)[0]);
+
+	this->beginTimer();
+
+	std::size_t CurrentMaterial = this->MaterialCount;
+	for(std::size_t DrawIndex = 0; DrawIndex < this->DrawCount; ++DrawIndex)
+	{
+		std::size_t const MaterialIndex = DrawIndex * this->MaterialCount / this->DrawCount;
+
+		switch(this->Mode)
+		{
+			case DIRECT:
+				this->setMaterial(MaterialIndex);
+				break;
+			case CACHED:
+				this->setMaterialCached(MaterialIndex);
+				break;
+			case SORTED:
+				if(MaterialIndex != CurrentMaterial)
+					this->setMaterial(MaterialIndex);
+				CurrentMaterial = MaterialIndex;
+				break;
+			default:
+				assert(0);
+				break;
+		}
+
+		glDrawArrays(GL_TRIANGLES, static_cast<GLint>(DrawIndex * VertexCount), VertexCount);
+	}
+
+	this->endTimer();
+	this->addDrawCount(this->DrawCount);
+
+	return true;
+}
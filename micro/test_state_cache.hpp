@@ -0,0 +1,56 @@
+#ifndef TEST_STATE_CACHE_INCLUDED
+#define TEST_STATE_CACHE_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Each draw sets the whole state of its material as a naive renderer would.
+// Draws are sorted by material so most of these calls are redundant.
+class testStateCache : public test
+{
+public:
+	enum mode
+	{
+		DIRECT,
+		CACHED,
+		// State changes issued by hand only when the material changes, the lower bound of the cache
+		SORTED,
+		MODE_MAX
+	};
+
+public:
+	testStateCache(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		mode Mode, std::size_t DrawCount, std::size_t MaterialCount);
+	virtual ~testStateCache();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	enum buffer
+	{
+		BUFFER_VERTEX,
+		BUFFER_TRANSFORM,
+		BUFFER_MAX
+	};
+
+	bool initProgram();
+	bool initBuffer();
+	bool initTexture();
+	bool initVertexArray();
+	void setMaterial(std::size_t MaterialIndex);
+	void setMaterialCached(std::size_t MaterialIndex);
+
+	mode const Mode;
+	std::size_t const DrawCount;
+	std::size_t const MaterialCount;
+	std::vector<GLuint> ProgramName;
+	std::vector<GLuint> TextureName;
+	std::array<GLuint, BUFFER_MAX> BufferName;
+	GLuint VertexArrayName;
+	GLuint SamplerName;
+};
+
+#endif//TEST_STATE_CACHE_INCLUDED
@@ -0,0 +1,86 @@
+#include "test_texture_compare.hpp"
+
+namespace
+{
+	// Byte loop gli::equal used before the bulk compare, the level view is evaluated for each byte
+	bool equalReference(gli::texture2D const & TextureA, gli::texture2D const & TextureB)
+	{
+		for(gli::texture2D::size_type Level = 0; Level < TextureA.levels(); ++Level)
+		for(gli::texture2D::size_type i = 0; i < TextureA[Level].size<glm::byte>(); ++i)
+		{
+			glm::byte A = *(TextureA[Level].data<glm::byte>() + i);
+			glm::byte B = *(TextureB[Level].data<glm::byte>() + i);
+			if(A != B)
+				return false;
+		}
+
+		return true;
+	}
+}//namespace
+
+testTextureCompare::testTextureCompare(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	mode Mode, mismatch Mismatch, std::string const & Filename
+) :
+	test(argc, argv, "testTextureCompare", Profile, 4, 2, FrameCount),
+	Texture(gli::load_dds((getDataDirectory() + Filename).c_str())),
+	Copy(gli::copy(Texture)),
+	Mode(Mode),
+	Mismatch(Mismatch)
+{
+	this->setCPUTimeSamples(true);
+
+	if(this->Copy.empty() || this->Mismatch == IDENTICAL)
+		return;
+
+	std::size_t const BlockSize = gli::block_size(this->Copy.format());
+	std::size_t const Offset = this->Mismatch == LAST_TEXEL ?
+		this->Copy.size() - BlockSize :
+		this->Copy.size() / 2 / BlockSize * BlockSize;
+
+	// Flips the high exponent bit of the last half or float component, far beyond the tolerance
+	*(this->Copy.data<glm::byte>() + Offset + BlockSize - 1) ^= 0x40;
+}
+
+testTextureCompare::~testTextureCompare()
+{}
+
+bool testTextureCompare::begin()
+{
+	return !this->Texture.empty();
+}
+
+bool testTextureCompare::end()
+{
+	return true;
+}
+
+bool testTextureCompare::render()
+{
+	bool Equal = false;
+	switch(this->Mode)
+	{
+		case REFERENCE:
+			Equal = equalReference(this->Texture, this->Copy);
+			break;
+		case EQUAL:
+			Equal = gli::equal(this->Texture, this->Copy);
+			break;
+		case EQUAL_TOLERANT:
+			Equal = gli::equal(this->Texture, this->Copy, 1.0f / 1024.f);
+			break;
+		case DIFF:
+		{
+			std::size_t Count = 0;
+			for(std::size_t Level = 0; Level < this->Texture.levels(); ++Level)
+				Count += gli::diff(this->Texture[Level], this->Copy[Level]).Count;
+			Equal = Count == 0;
+		}
+		break;
+		default:
+			assert(0);
+			break;
+	}
+
+	return Equal == (this->Mismatch == IDENTICAL);
+}
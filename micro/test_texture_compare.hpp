@@ -0,0 +1,44 @@
+#ifndef TEST_TEXTURE_COMPARE_INCLUDED
+#define TEST_TEXTURE_COMPARE_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+class testTextureCompare : public test
+{
+public:
+	enum mode
+	{
+		REFERENCE,
+		EQUAL,
+		EQUAL_TOLERANT,
+		DIFF,
+		MODE_MAX
+	};
+
+	// Texel changed in the copy, the mismatching runs exercise the early outs and the tolerant paths
+	enum mismatch
+	{
+		IDENTICAL,
+		MIDDLE_TEXEL,
+		LAST_TEXEL
+	};
+
+public:
+	testTextureCompare(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		mode Mode, mismatch Mismatch, std::string const & Filename);
+	virtual ~testTextureCompare();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	gli::texture2D const Texture;
+	gli::texture2D Copy;
+	mode const Mode;
+	mismatch const Mismatch;
+};
+
+#endif//TEST_TEXTURE_COMPARE_INCLUDED
@@ -0,0 +1,186 @@
+#include "test_texture_streaming.hpp"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+	char const * VERT_SHADER_SOURCE("micro/test_texture_streaming.vert");
+	char const * FRAG_SHADER_SOURCE("micro/test_texture_streaming.frag");
+}//namespace
+
+testTextureStreaming::testTextureStreaming(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	mode Mode, std::size_t SlotCount, std::size_t SlotSize, std::string const & Filename
+) :
+	test(argc, argv, "testTextureStreaming", Profile, 4, 4, FrameCount),
+	Texture(gli::load_dds((getDataDirectory() + Filename).c_str())),
+	Mode(Mode),
+	SlotCount(SlotCount),
+	SlotSize(SlotSize),
+	PixelBufferName(0),
+	ProgramName(0),
+	VertexArrayName(0),
+	FrameIndex(0),
+	TextureIndex(0),
+	UploadedBytes(0)
+{
+	this->TextureName.fill(0);
+}
+
+testTextureStreaming::~testTextureStreaming()
+{}
+
+bool testTextureStreaming::begin()
+{
+	if(this->Texture.empty())
+		return false;
+
+	if(this->Mode == RING)
+	{
+		// Leave a core to the render thread
+		std::size_t const WorkerCount = std::min<std::size_t>(2, std::max(1u, std::thread::hardware_concurrency()) - 1);
+		this->Streamer.reset(new streamer(this->SlotCount, this->SlotSize, WorkerCount));
+		if(!this->Streamer->isValid())
+			return false;
+	}
+
+	compiler Compiler;
+	GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE);
+	GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+
+	this->ProgramName = glCreateProgram();
+	glAttachShader(this->ProgramName, VertShaderName);
+	glAttachShader(this->ProgramName, FragShaderName);
+	glLinkProgram(this->ProgramName);
+
+	bool Validated = Compiler.check();
+	Validated = Validated && Compiler.checkProgram(this->ProgramName);
+	if(!Validated)
+		return false;
+
+	gli::gl GL;
+	gli::gl::format const Format = GL.translate(this->Texture.format());
+
+	glGenTextures(TEXTURE_COUNT, &this->TextureName[0]);
+	for(std::size_t Index = 0; Index < TEXTURE_COUNT; ++Index)
+	{
+		glBindTexture(GL_TEXTURE_2D, this->TextureName[Index]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexStorage2D(GL_TEXTURE_2D, static_cast<GLsizei>(this->Texture.levels()), Format.Internal,
+			static_cast<GLsizei>(this->Texture.dimensions().x), static_cast<GLsizei>(this->Texture.dimensions().y));
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenBuffers(1, &this->PixelBufferName);
+	glGenVertexArrays(1, &this->VertexArrayName);
+
+	return this->checkError("begin");
+}
+
+bool testTextureStreaming::end()
+{
+	if(this->Streamer)
+		this->UploadedBytes += this->Streamer->finish();
+
+	std::chrono::high_resolution_clock::time_point const TimeEnd = std::chrono::high_resolution_clock::now();
+	double const Seconds = std::chrono::duration_cast<std::chrono::duration<double> >(TimeEnd - this->TimeBegin).count();
+	double const Megabytes = static_cast<double>(this->UploadedBytes) / (1024.0 * 1024.0);
+	fprintf(stdout, "\nUploaded %2.1f MB at %2.1f MB/s\n", Megabytes, Seconds > 0.0 ? Megabytes / Seconds : 0.0);
+
+	this->Streamer.reset();
+
+	glDeleteVertexArrays(1, &this->VertexArrayName);
+	glDeleteBuffers(1, &this->PixelBufferName);
+	glDeleteTextures(TEXTURE_COUNT, &this->TextureName[0]);
+	glDeleteProgram(this->ProgramName);
+
+	return true;
+}
+
+// Path of gl-320-texture-streaming: the unpack buffer is respecified, mapped and filled for each level
+void testTextureStreaming::uploadReference(GLuint TextureName)
+{
+	gli::gl GL;
+	gli::gl::format const Format = GL.translate(this->Texture.format());
+	bool const Compressed = gli::is_compressed(this->Texture.format());
+
+	glBindTexture(GL_TEXTURE_2D, TextureName);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->PixelBufferName);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	for(gli::texture2D::size_type Level = 0; Level < this->Texture.levels(); ++Level)
+	{
+		GLsizei const Size = static_cast<GLsizei>(this->Texture[Level].size());
+		glm::ivec2 const Dimensions(this->Texture[Level].dimensions());
+
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, Size, nullptr, GL_STREAM_DRAW);
+		void* Pointer = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, Size, GL_MAP_WRITE_BIT);
+		memcpy(Pointer, this->Texture[Level].data(), Size);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+		if(Compressed)
+			glCompressedTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(Level),
+				0, 0, Dimensions.x, Dimensions.y, Format.Internal, Size, nullptr);
+		else
+			glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(Level),
+				0, 0, Dimensions.x, Dimensions.y, Format.External, Format.Type, nullptr);
+
+		this->UploadedBytes += Size;
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+bool testTextureStreaming::render()
+{
+	// The frame time is measured on the CPU from one render call to the next so that it includes the swap
+	std::chrono::high_resolution_clock::time_point const TimeCurrent = std::chrono::high_resolution_clock::now();
+	if(this->FrameIndex == 0)
+		this->TimeBegin = TimeCurrent;
+	else
+		this->addTimeSample(static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(TimeCurrent - this->TimeFrame).count()));
+	this->TimeFrame = TimeCurrent;
+
+	switch(this->Mode)
+	{
+		case REFERENCE:
+			this->uploadReference(this->TextureName[this->TextureIndex]);
+			this->TextureIndex = (this->TextureIndex + 1) % TEXTURE_COUNT;
+			break;
+		case RING:
+			// A new texture is queued once the previous one is entirely issued, so the ring depth bounds the bandwidth per frame
+			if(this->Streamer->idle())
+			{
+				this->Streamer->upload(this->TextureName[this->TextureIndex], this->Texture);
+				this->TextureIndex = (this->TextureIndex + 1) % TEXTURE_COUNT;
+			}
+			this->UploadedBytes += this->Streamer->update();
+
+			// Levels too large for the slots bypass the ring
+			this->UploadedBytes += this->Streamer->getStats().SynchronousBytes;
+			this->addSample("synchronous uploads", static_cast<double>(this->Streamer->getStats().SynchronousUploads), false);
+			this->Streamer->resetStats();
+			break;
+		default:
+			assert(0);
+			break;
+	}
+
+	glm::uvec2 const WindowSize = this->getWindowSize();
+	glViewport(0, 0, static_cast<GLsizei>(WindowSize.x), static_cast<GLsizei>(WindowSize.y));
+	glClearBufferfv(GL_COLOR, 0, &glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)[0]);
+
+	// Sample the oldest texture, which no pending upload targets
+	glUseProgram(this->ProgramName);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, this->TextureName[(this->TextureIndex + 1) % TEXTURE_COUNT]);
+	glBindVertexArray(this->VertexArrayName);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	++this->FrameIndex;
+
+	return true;
+}
@@ -0,0 +1,54 @@
+#ifndef TEST_TEXTURE_STREAMING_INCLUDED
+#define TEST_TEXTURE_STREAMING_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+#include "streaming.hpp"
+#include <chrono>
+
+class testTextureStreaming : public test
+{
+public:
+	enum mode
+	{
+		REFERENCE,
+		RING,
+		MODE_MAX
+	};
+
+public:
+	testTextureStreaming(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		mode Mode, std::size_t SlotCount, std::size_t SlotSize, std::string const & Filename);
+	virtual ~testTextureStreaming();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	// Streaming targets are rotated so that an upload never writes the texture being sampled
+	enum
+	{
+		TEXTURE_COUNT = 3
+	};
+
+	void uploadReference(GLuint TextureName);
+
+	gli::texture2D const Texture;
+	mode const Mode;
+	std::size_t const SlotCount;
+	std::size_t const SlotSize;
+	std::unique_ptr<streamer> Streamer;
+	std::array<GLuint, TEXTURE_COUNT> TextureName;
+	GLuint PixelBufferName;
+	GLuint ProgramName;
+	GLuint VertexArrayName;
+	std::size_t FrameIndex;
+	std::size_t TextureIndex;
+	std::size_t UploadedBytes;
+	std::chrono::high_resolution_clock::time_point TimeBegin;
+	std::chrono::high_resolution_clock::time_point TimeFrame;
+};
+
+#endif//TEST_TEXTURE_STREAMING_INCLUDED
@@ -0,0 +1,124 @@
+#include "test_texture_upload.hpp"
+
+testTextureUpload::testTextureUpload(
+	int argc, char* argv[], profile Profile, std::size_t FrameCount,
+	method Method, source Source, std::string const & Filename, std::size_t UploadCount
+) :
+	test(argc, argv, "testTextureUpload", Profile, 4, 3, FrameCount),
+	Texture(gli::load_dds((getDataDirectory() + Filename).c_str())),
+	Filename(Filename),
+	Method(Method),
+	Source(Source),
+	UploadCount(UploadCount),
+	TextureSize(0),
+	TexelCount(0),
+	TextureName(0),
+	PixelBufferName(0)
+{
+	assert(UploadCount > 0);
+}
+
+testTextureUpload::~testTextureUpload()
+{}
+
+bool testTextureUpload::begin()
+{
+	if(this->Texture.empty())
+	{
+		fprintf(stderr, "Failed to load %s\n", this->Filename.c_str());
+		return false;
+	}
+
+	gli::gl GL;
+	gli::gl::format const Format = GL.translate(this->Texture.format());
+
+	GLint Supported = GL_FALSE;
+	glGetInternalformativ(GL_TEXTURE_2D, Format.Internal, GL_INTERNALFORMAT_SUPPORTED, 1, &Supported);
+	if(Supported != GL_TRUE)
+	{
+		this->skip(format("The format of %s is not supported", this->Filename.c_str()).c_str());
+		return true;
+	}
+
+	this->LevelOffsets.resize(this->Texture.levels());
+	for(gli::texture2D::size_type Level = 0; Level < this->Texture.levels(); ++Level)
+	{
+		glm::uvec2 const Dimensions(this->Texture[Level].dimensions());
+
+		this->LevelOffsets[Level] = this->TextureSize;
+		this->TextureSize += this->Texture[Level].size();
+		this->TexelCount += Dimensions.x * Dimensions.y;
+	}
+
+	glGenTextures(1, &this->TextureName);
+	glBindTexture(GL_TEXTURE_2D, this->TextureName);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(this->Texture.levels() - 1));
+	if(this->Method == TEX_STORAGE_SUB_IMAGE)
+		glTexStorage2D(GL_TEXTURE_2D, static_cast<GLsizei>(this->Texture.levels()), Format.Internal,
+			static_cast<GLsizei>(this->Texture.dimensions().x), static_cast<GLsizei>(this->Texture.dimensions().y));
+
+	if(this->Source == PIXEL_BUFFER)
+	{
+		glGenBuffers(1, &this->PixelBufferName);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->PixelBufferName);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(this->TextureSize), nullptr, GL_STATIC_DRAW);
+		for(gli::texture2D::size_type Level = 0; Level < this->Texture.levels(); ++Level)
+			glBufferSubData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLintptr>(this->LevelOffsets[Level]),
+				static_cast<GLsizeiptr>(this->Texture[Level].size()), this->Texture[Level].data());
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	return this->checkError("begin");
+}
+
+bool testTextureUpload::end()
+{
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	glDeleteBuffers(1, &this->PixelBufferName);
+	glDeleteTextures(1, &this->TextureName);
+
+	return true;
+}
+
+void testTextureUpload::upload()
+{
+	gli::gl GL;
+	gli::gl::format const Format = GL.translate(this->Texture.format());
+	bool const Compressed = gli::is_compressed(this->Texture.format());
+
+	for(gli::texture2D::size_type Level = 0; Level < this->Texture.levels(); ++Level)
+	{
+		GLint const LevelIndex = static_cast<GLint>(Level);
+		GLsizei const Size = static_cast<GLsizei>(this->Texture[Level].size());
+		glm::ivec2 const Dimensions(this->Texture[Level].dimensions());
+		void const * Data = this->Source == PIXEL_BUFFER ? BUFFER_OFFSET(this->LevelOffsets[Level]) : this->Texture[Level].data();
+
+		if(Compressed && this->Method == TEX_IMAGE)
+			glCompressedTexImage2D(GL_TEXTURE_2D, LevelIndex, Format.Internal, Dimensions.x, Dimensions.y, 0, Size, Data);
+		else if(Compressed)
+			glCompressedTexSubImage2D(GL_TEXTURE_2D, LevelIndex, 0, 0, Dimensions.x, Dimensions.y, Format.Internal, Size, Data);
+		else if(this->Method == TEX_IMAGE)
+			glTexImage2D(GL_TEXTURE_2D, LevelIndex, Format.Internal, Dimensions.x, Dimensions.y, 0, Format.External, Format.Type, Data);
+		else
+			glTexSubImage2D(GL_TEXTURE_2D, LevelIndex, 0, 0, Dimensions.x, Dimensions.y, Format.External, Format.Type, Data);
+	}
+}
+
+bool testTextureUpload::render()
+{
+	this->beginTimer();
+	for(std::size_t UploadIndex = 0; UploadIndex < this->UploadCount; ++UploadIndex)
+		this->upload();
+	this->endTimer();
+
+	// The rates use the CPU render time, wait for the asynchronous uploads from the pixel buffer like the others
+	glFinish();
+
+	this->addUploadSize(this->TextureSize * this->UploadCount);
+	this->addTexelCount(this->TexelCount * this->UploadCount);
+
+	return true;
+}
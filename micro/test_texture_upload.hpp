@@ -0,0 +1,56 @@
+#ifndef TEST_TEXTURE_UPLOAD_INCLUDED
+#define TEST_TEXTURE_UPLOAD_INCLUDED
+
+#include "test.hpp"
+#include "intercept_gl11.hpp"
+
+// Each frame uploads all the levels of a DDS file UploadCount times then waits for the uploads to complete.
+// Compressed formats go through the glCompressedTex* variant of each method.
+class testTextureUpload : public test
+{
+public:
+	enum method
+	{
+		// glTexImage2D respecifies each level of the texture
+		TEX_IMAGE,
+		// glTexSubImage2D into an immutable texture allocated once with glTexStorage2D
+		TEX_STORAGE_SUB_IMAGE,
+		METHOD_MAX
+	};
+
+	enum source
+	{
+		// Texels read from client memory
+		CLIENT_MEMORY,
+		// Texels read from a pixel unpack buffer filled once when the test begins
+		PIXEL_BUFFER,
+		SOURCE_MAX
+	};
+
+public:
+	testTextureUpload(
+		int argc, char* argv[], profile Profile, std::size_t FrameCount,
+		method Method, source Source, std::string const & Filename, std::size_t UploadCount);
+	virtual ~testTextureUpload();
+
+	virtual bool begin();
+	virtual bool end();
+	virtual bool render();
+
+private:
+	void upload();
+
+	gli::texture2D const Texture;
+	std::string const Filename;
+	method const Method;
+	source const Source;
+	std::size_t const UploadCount;
+	// Offset of each level in the pixel unpack buffer
+	std::vector<std::size_t> LevelOffsets;
+	std::size_t TextureSize;
+	std::size_t TexelCount;
+	GLuint TextureName;
+	GLuint PixelBufferName;
+};
+
+#endif//TEST_TEXTURE_UPLOAD_INCLUDED
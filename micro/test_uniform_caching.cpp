@@ -22,12 +22,19 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "test.hpp"
+#include "intercept_gl11.hpp"
 #include "test_uniform_caching.hpp"
+#include "uniform.hpp"
 
 namespace
 {
 	char const * VERT_SHADER_SOURCE("micro/test_uniform_caching.vert");
 	char const * FRAG_SHADER_SOURCE("micro/test_uniform_caching.frag");
+	char const * VERT_SHADER_SOURCE_BLOCK("micro/test_uniform_caching_block.vert");
+	char const * FRAG_SHADER_SOURCE_BLOCK("micro/test_uniform_caching_block.frag");
+
+	// Frames of uniform blocks the arena holds before waiting on the GPU
+	std::size_t const ARENA_FRAME_COUNT(3);
 
 	struct vertex
 	{
@@ -59,7 +66,10 @@ namespace
 	{
 		UNIFORM_SINGLE,
 		UNIFORM_REDUNDANT,
-		UNIFORM_UNIQUE
+		UNIFORM_UNIQUE,
+		UNIFORM_UNIQUE_DSA,
+		UNIFORM_ARENA_RANGE,
+		UNIFORM_ARENA_MULTI
 	};
 }//namespace
 
@@ -69,6 +79,7 @@ public:
 	test_uniform_caching(int argc, char* argv[], std::size_t FrameCount, glm::uvec2 const & WindowSize, glm::vec2 const & TileSize, std::size_t TrianglePairPerTile, uniformMode UniformMode) :
 		test(argc, argv, "test_uniform_caching", test::CORE, 3, 3, FrameCount, RUN_ONLY, WindowSize),
 		VertexArrayName(0),
+		PipelineName(0),
 		ProgramName(0),
 		SamplerName(0),
 		TextureName(0),
@@ -78,7 +89,9 @@ public:
 		UniformDiffuse(-1),
 		UniformMVP(-1),
 		UniformMode(UniformMode)
-	{}
+	{
+		this->BufferName.fill(0);
+	}
 
 private:
 	std::array<GLuint, buffer::MAX> BufferName;
@@ -93,6 +106,13 @@ private:
 	GLint UniformDiffuse;
 	GLint UniformMVP;
 	uniformMode UniformMode;
+	glm::mat4 Projection;
+	std::unique_ptr<gl::uniform_arena> Arena;
+
+	bool isArena() const
+	{
+		return this->UniformMode == UNIFORM_ARENA_RANGE || this->UniformMode == UNIFORM_ARENA_MULTI;
+	}
 
 	bool initProgram()
 	{
@@ -101,8 +121,8 @@ private:
 		if(Validated)
 		{
 			compiler Compiler;
-			GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + VERT_SHADER_SOURCE);
-			GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + FRAG_SHADER_SOURCE);
+			GLuint VertShaderName = Compiler.create(GL_VERTEX_SHADER, getDataDirectory() + (this->isArena() ? VERT_SHADER_SOURCE_BLOCK : VERT_SHADER_SOURCE));
+			GLuint FragShaderName = Compiler.create(GL_FRAGMENT_SHADER, getDataDirectory() + (this->isArena() ? FRAG_SHADER_SOURCE_BLOCK : FRAG_SHADER_SOURCE));
 
 			ProgramName = glCreateProgram();
 			glProgramParameteri(this->ProgramName, GL_PROGRAM_SEPARABLE, GL_TRUE);
@@ -194,20 +214,34 @@ private:
 			Validated = initVertexArray();
 		if(Validated)
 			Validated = initProgram();
+		if(Validated && this->isArena())
+		{
+			// Each draw writes a transform and a material block, 256 bytes covers the largest offset alignments
+			std::size_t const DrawCount = this->VertexCount / 6;
+			this->Arena.reset(new gl::uniform_arena(DrawCount * 2 * 256 * ARENA_FRAME_COUNT, this->UniformMode == UNIFORM_ARENA_MULTI));
+			Validated = this->Arena->isValid();
+		}
 		return Validated;
 	}
 
 	bool begin()
 	{
+		// gl::uniform_arena would silently fall back to glBindBufferRange
+		if(this->UniformMode == UNIFORM_ARENA_MULTI && !this->isExtensionSupported("GL_ARB_multi_bind"))
+		{
+			this->skip("GL_ARB_multi_bind is not supported");
+			return true;
+		}
+
 		bool Validated = this->init();
 
 		if(Validated)
 		{
 			glm::vec2 WindowSize(this->getWindowSize());
-			glm::mat4 Perspective = glm::ortho(0.0f, WindowSize.x, 0.0f, WindowSize.y);
+			this->Projection = glm::ortho(0.0f, WindowSize.x, 0.0f, WindowSize.y);
 
 			glUseProgram(ProgramName);
-			glUniformMatrix4fv(UniformMVP, 1, GL_FALSE, &Perspective[0][0]);
+			glUniformMatrix4fv(UniformMVP, 1, GL_FALSE, &this->Projection[0][0]);
 
 			glBindVertexArray(VertexArrayName);
 			glViewportIndexedf(0, 0, 0, WindowSize.x, WindowSize.y);
@@ -221,6 +255,7 @@ private:
 
 	bool end()
 	{
+		this->Arena.reset();
 		glDeleteBuffers(buffer::MAX, &this->BufferName[0]);
 		glDeleteProgramPipelines(1, &this->PipelineName);
 		glDeleteProgram(this->ProgramName);
@@ -248,10 +283,24 @@ private:
 				glm::vec4 Color = glm::linearRand(glm::vec4(0), glm::vec4(1));
 				glUniform4f(UniformDiffuse, Color.r, Color.g, Color.b, Color.a);
 			}
+			if(this->UniformMode == UNIFORM_UNIQUE_DSA)
+			{
+				glm::vec4 Color = glm::linearRand(glm::vec4(0), glm::vec4(1));
+				glProgramUniform4f(this->ProgramName, UniformDiffuse, Color.r, Color.g, Color.b, Color.a);
+			}
+			if(this->isArena())
+			{
+				this->Arena->set(semantic::uniform::TRANSFORM0, this->Projection);
+				this->Arena->set(semantic::uniform::MATERIAL, glm::linearRand(glm::vec4(0), glm::vec4(1)));
+				this->Arena->bind();
+			}
 
 			glDrawArraysInstanced(GL_TRIANGLES, static_cast<GLint>(i), static_cast<GLsizei>(6), 1);
 		}
 
+		if(this->Arena)
+			this->Arena->fence();
+
 		this->endTimer();
 
 		return true;
@@ -294,6 +343,15 @@ int main_uniform_caching(int argc, char* argv[])
 	Entries.push_back(entry(
 		message_format("UNIFORM_UNIQUE mode"),
 		glm::uvec2(128), glm::vec2(8, 8), 16, UNIFORM_UNIQUE));
+	Entries.push_back(entry(
+		message_format("UNIFORM_UNIQUE_DSA mode"),
+		glm::uvec2(128), glm::vec2(8, 8), 16, UNIFORM_UNIQUE_DSA));
+	Entries.push_back(entry(
+		message_format("UNIFORM_ARENA_RANGE mode"),
+		glm::uvec2(128), glm::vec2(8, 8), 16, UNIFORM_ARENA_RANGE));
+	Entries.push_back(entry(
+		message_format("UNIFORM_ARENA_MULTI mode"),
+		glm::uvec2(128), glm::vec2(8, 8), 16, UNIFORM_ARENA_MULTI));
 
 	csv CSV;
 	int Error(0);
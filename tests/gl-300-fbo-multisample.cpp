@@ -234,8 +234,6 @@ private:
 	{
 		bool Validated = true;
 
-		caps Caps(caps::COMPATIBILITY);
-
 		if(Validated)
 			Validated = initProgram();
 		if(Validated)
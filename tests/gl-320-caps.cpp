@@ -34,7 +34,7 @@ private:
 
 	bool begin()
 	{
-		caps Caps(caps::CORE);
+		caps const & Caps = this->getCaps();
 
 		bool Validated = true;
 
@@ -242,8 +242,6 @@ private:
 
 	bool begin()
 	{
-		caps Caps(caps::CORE);
-
 		bool Validated = true;
 
 		if(Validated)
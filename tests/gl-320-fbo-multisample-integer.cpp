@@ -261,7 +261,7 @@ private:
 
 	bool begin()
 	{
-		caps Caps(caps::CORE);
+		caps const & Caps = this->getCaps();
 
 		// Multisample integer texture is optional
 		bool Validated = Caps.Limits.MAX_INTEGER_SAMPLES > 1;
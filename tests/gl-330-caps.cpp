@@ -33,8 +33,6 @@ public:
 private:
 	bool checkCaps()
 	{
-		caps Caps(caps::CORE);
-
 		return true;
 	}
 
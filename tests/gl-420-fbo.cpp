@@ -268,8 +268,6 @@ private:
 	{
 		bool Validated(true);
 
-		caps Caps(caps::CORE);
-
 		if(Validated)
 			Validated = initProgram();
 		if(Validated)
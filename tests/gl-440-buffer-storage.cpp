@@ -54,7 +54,6 @@ namespace
 			COPY,
 			VERTEX,
 			ELEMENT,
-			TRANSFORM,
 			MAX
 		};
 	}//namespace buffer
@@ -68,8 +67,7 @@ public:
 		PipelineName(0),
 		VertexArrayName(0),
 		TextureName(0),
-		ProgramName(0),
-		UniformPointer(nullptr)
+		ProgramName(0)
 	{}
 
 private:
@@ -78,7 +76,7 @@ private:
 	GLuint TextureName;
 	GLuint ProgramName;
 	std::array<GLuint, buffer::MAX> BufferName;
-	glm::mat4* UniformPointer;
+	std::unique_ptr<gl::ring> TransformRing;
 
 	bool initProgram()
 	{
@@ -138,9 +136,9 @@ private:
 		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UniformBufferOffset);
 		GLint UniformBlockSize = glm::max(GLint(sizeof(glm::mat4)), UniformBufferOffset);
 
-		glBindBuffer(GL_UNIFORM_BUFFER, BufferName[buffer::TRANSFORM]);
-		glBufferStorage(GL_UNIFORM_BUFFER, UniformBlockSize, nullptr, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		// Each frame writes its transform in a new block, a block is reused once the frame using it is completed
+		TransformRing.reset(new gl::ring(UniformBlockSize * 8, UniformBufferOffset, gl::buffer::COHERENT_BIT));
+		Validated = Validated && TransformRing->isValid();
 
 		return Validated;
 	}
@@ -209,25 +207,13 @@ private:
 			Validated = initVertexArray();
 		if(Validated)
 			Validated = initTexture();
-		if(Validated)
-		{
-			glBindBuffer(GL_UNIFORM_BUFFER, BufferName[buffer::TRANSFORM]);
-			UniformPointer = (glm::mat4*)glMapBufferRange(
-				GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4),
-				GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-		}
 
 		return Validated;
 	}
 
 	bool end()
 	{
-		if(!UniformPointer)
-		{
-			glBindBuffer(GL_UNIFORM_BUFFER, BufferName[buffer::TRANSFORM]);
-			glUnmapBuffer(GL_UNIFORM_BUFFER);
-			UniformPointer = nullptr;
-		}
+		TransformRing.reset();
 
 		glDeleteProgramPipelines(1, &PipelineName);
 		glDeleteProgram(ProgramName);
@@ -242,11 +228,12 @@ private:
 	{
 		glm::vec2 WindowSize(this->getWindowSize());
 
+		gl::ring::allocation const Transform = TransformRing->allocate(sizeof(glm::mat4));
 		{
 			glm::mat4 Projection = glm::perspective(glm::pi<float>() * 0.25f, WindowSize.x / WindowSize.y, 0.1f, 100.0f);
 			glm::mat4 MVP = Projection * this->test::view() * glm::mat4(1.0f);
 
-			*UniformPointer = MVP;
+			*static_cast<glm::mat4*>(Transform.Pointer) = MVP;
 		}
 
 		glViewportIndexedf(0, 0, 0, WindowSize.x, WindowSize.y);
@@ -256,11 +243,13 @@ private:
 		glActiveTexture(GL_TEXTURE0 + semantic::sampler::DIFFUSE);
 		glBindTexture(GL_TEXTURE_2D_ARRAY, TextureName);
 		glBindVertexArray(VertexArrayName);
-		glBindBufferBase(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, BufferName[buffer::TRANSFORM]);
+		glBindBufferRange(GL_UNIFORM_BUFFER, semantic::uniform::TRANSFORM0, TransformRing->name(), Transform.Offset, sizeof(glm::mat4));
 		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, semantic::storage::VERTEX, BufferName[buffer::VERTEX]);
 
 		glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, ElementCount, GL_UNSIGNED_SHORT, 0, 1, 0, 0);
 
+		TransformRing->fence();
+
 		return true;
 	}
 };
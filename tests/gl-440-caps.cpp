@@ -33,8 +33,6 @@ public:
 private:
 	bool checkCaps()
 	{
-		caps Caps(caps::CORE);
-
 		//Caps.Version.SHADING_LANGUAGE_VERSION
 
 		return true;
@@ -33,7 +33,7 @@ public:
 private:
 	bool checkCaps()
 	{
-		caps Caps(caps::CORE);
+		caps const & Caps = this->getCaps();
 
 		if(Caps.Limits.MAX_SHADER_STORAGE_BLOCK_SIZE < (2 << 27))
 			return false;
@@ -266,8 +266,6 @@ private:
 				WindowSize * glm::linearRand(0.0f, 1.0f));
 		}
 
-		caps Caps(caps::CORE);
-
 		if (Validated)
 			Validated = initProgram();
 		if (Validated)
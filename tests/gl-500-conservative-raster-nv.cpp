@@ -209,8 +209,6 @@ private:
 	{
 		bool Validated(true);
 
-		caps Caps(caps::CORE);
-
 		if(Validated)
 			Validated = initProgram();
 		if(Validated)
@@ -337,8 +337,6 @@ private:
 		if(Validated)
 			Validated = initTexture();
 
-		caps Caps(caps::CORE);
-
 		glm::vec2 WindowSize(this->getWindowSize());
 		this->Viewport[0] = glm::vec4(WindowSize.x / 3.0f * 0.0f, 0, WindowSize.x / 3, WindowSize.y);
 		this->Viewport[1] = glm::vec4(WindowSize.x / 3.0f * 1.0f, 0, WindowSize.x / 3, WindowSize.y);
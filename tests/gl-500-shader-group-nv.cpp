@@ -214,8 +214,6 @@ private:
 	{
 		bool Validated = this->checkExtension("GL_NV_shader_thread_group");
 
-		caps Caps(caps::CORE);
-
 		if(Validated)
 			Validated = initProgram();
 		if(Validated)